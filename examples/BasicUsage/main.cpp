@@ -1,6 +1,5 @@
 
 #include <fstream>
-#include <unordered_map>
 
 #include "dbcppp/CApi.h"
 #include "dbcppp/Network.h"
@@ -61,28 +60,22 @@ int main()
         return -1;
     }
 
-    std::unordered_map<uint64_t, const dbcppp::IMessage *> messages;
-    for (const dbcppp::IMessage& msg : net->Messages())
-    {
-        messages.insert(std::make_pair(msg.Id(), &msg));
-    }
     can_frame frame;
     while (1)
     {
         receive_frame_data(&frame);
-        auto iter = messages.find(frame.can_id);
-        if (iter != messages.end())
+        // can_id can be passed as it is, the EFF flag matches the extended id flag of the DBC ids
+        const dbcppp::IMessage* msg = net->MessageById(frame.can_id);
+        if (msg)
         {
-            const dbcppp::IMessage* msg = iter->second;
             std::cout << "Received Message: " << msg->Name() << "\n";
-            for (const dbcppp::ISignal& sig : msg->Signals())
+            // only contains the signals selected by the multiplexer
+            dbcppp::IMessage::DecodeResult result;
+            msg->Decode(frame.data, result);
+            for (const auto& entry : result)
             {
-                const dbcppp::ISignal* mux_sig = msg->MuxSignal();
-                if (sig.MultiplexerIndicator() != dbcppp::ISignal::EMultiplexer::MuxValue ||
-                    (mux_sig && mux_sig->Decode(frame.data) == sig.MultiplexerSwitchValue()))
-                {
-                    std::cout << "\t" << sig.Name() << "=" << sig.RawToPhys(sig.Decode(frame.data)) << sig.Unit() << "\n";
-                }
+                const dbcppp::ISignal& sig = msg->Signals_Get(entry.signal);
+                std::cout << "\t" << sig.Name() << "=" << sig.RawToPhys(entry.raw) << sig.Unit() << "\n";
             }
         }
     }
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+#include "Export.h"
+#include "Network.h"
+
+namespace dbcppp
+{
+    /// \brief Maps frames received on several buses to their messages
+    ///
+    /// Each bus is identified by a numeric index (e.g. the index of the CAN channel) and described by a network.
+    /// Routing a frame costs one array access for the bus and one INetwork::MessageById lookup for the id.
+    /// Frames which can't be routed are counted, so gaps in the loaded databases show up.
+    /// The networks aren't owned by the router, they must outlive it. The counters make Route non-const,
+    /// so a router must not be shared between threads.
+    class DBCPPP_API IBusRouter
+    {
+    public:
+        static std::unique_ptr<IBusRouter> Create();
+
+        virtual ~IBusRouter() = default;
+
+        /// \brief Registers the network of a bus, replaces the bus' previous network
+        ///
+        /// @param network nullptr removes the bus
+        virtual void SetBus(std::size_t bus, const INetwork* network) = 0;
+        /// \brief Network of the bus, nullptr if the bus isn't registered
+        virtual const INetwork* Bus(std::size_t bus) const = 0;
+        /// \brief One plus the highest bus index ever registered
+        virtual std::size_t Buses_Size() const = 0;
+
+        /// \brief Returns the message of the frame, nullptr if the bus isn't registered or doesn't know the id
+        ///
+        /// @param id same format as for INetwork::MessageById
+        virtual const IMessage* Route(std::size_t bus, uint64_t id) = 0;
+
+        /// \brief Number of frames Route found a message for
+        virtual uint64_t Routed() const = 0;
+        /// \brief Number of frames Route returned nullptr for, including the frames of unregistered buses
+        virtual uint64_t Unrouted() const = 0;
+        /// \brief Number of frames of a registered bus whose id is unknown to the bus' network
+        virtual uint64_t Unrouted(std::size_t bus) const = 0;
+        /// \brief Number of frames of buses which weren't registered
+        virtual uint64_t UnknownBus() const = 0;
+        virtual void ResetCounters() = 0;
+    };
+}
@@ -201,6 +201,7 @@ extern "C"
     DBCPPP_API uint64_t dbcppp_NetworkValueTables_Size(const dbcppp_Network* net);
     DBCPPP_API const dbcppp_Message* dbcppp_NetworkMessages_Get(const dbcppp_Network* net, uint64_t i);
     DBCPPP_API uint64_t dbcppp_NetworkMessages_Size(const dbcppp_Network* net);    
+    DBCPPP_API const dbcppp_Message* dbcppp_NetworkMessageById(const dbcppp_Network* net, uint64_t id);
     DBCPPP_API const dbcppp_EnvironmentVariable* dbcppp_NetworkEnvironmentVariables_Get(const dbcppp_Network* net, uint64_t i);
     DBCPPP_API uint64_t dbcppp_NetworkEnvironmentVariables_Size(const dbcppp_Network* net);
     DBCPPP_API const dbcppp_AttributeDefinition* dbcppp_NetworkAttributeDefinitions_Get(const dbcppp_Network* net, uint64_t i);
@@ -263,9 +264,13 @@ extern "C"
     DBCPPP_API const char* dbcppp_SignalComment(const dbcppp_Signal* sig);
     DBCPPP_API dbcppp_ESignalExtendedValueType dbcppp_SignalExtended_ValueType(const dbcppp_Signal* sig);
     DBCPPP_API uint64_t dbcppp_SignalDecode(const dbcppp_Signal* sig, const void* bytes);
+    DBCPPP_API uint64_t dbcppp_SignalDecodeSized(const dbcppp_Signal* sig, const void* bytes, uint64_t size);
+    DBCPPP_API void dbcppp_SignalDecodeBatch(const dbcppp_Signal* sig, const void* bytes, uint64_t stride, uint64_t count, uint64_t* values);
     DBCPPP_API void dbcppp_SignalEncode(const dbcppp_Signal* sig, uint64_t raw, void* buffer);
     DBCPPP_API double dbcppp_SignalRawToPhys(const dbcppp_Signal* sig, uint64_t raw);
     DBCPPP_API uint64_t dbcppp_SignalPhysToRaw(const dbcppp_Signal* sig, double phys);
+    DBCPPP_API void dbcppp_SignalRawToPhysBatch(const dbcppp_Signal* sig, const uint64_t* raw, double* phys, uint64_t n);
+    DBCPPP_API void dbcppp_SignalPhysToRawBatch(const dbcppp_Signal* sig, const double* phys, uint64_t* raw, uint64_t n);
 
     DBCPPP_API const dbcppp_SignalType* dbcppp_SignalTypeCreate(
           const char* name
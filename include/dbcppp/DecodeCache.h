@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <optional>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "Export.h"
+#include "Message.h"
+
+namespace dbcppp
+{
+    /// \brief Bounded cache of decoded frames keyed by message and payload
+    ///
+    /// Messages which cycle through a few distinct payloads are decoded once per payload, the following
+    /// frames with the same payload are looked up. When the cache is full the entries are evicted with
+    /// the CLOCK policy (an approximation of least recently used).
+    /// A cache can be used for the messages of any number of networks, but it isn't thread-safe.
+    /// The cached descriptions point into the networks, so they must outlive the cache (or the next Clear).
+    class DBCPPP_API IDecodeCache
+    {
+    public:
+        struct Value
+        {
+            /// index of the signal in IMessage::Signals()
+            uint32_t signal;
+            ISignal::raw_t raw;
+            /// ISignal::RawToPhys(raw)
+            double physical;
+            /// ISignal::ValueToDescription(raw)
+            std::optional<std::string_view> description;
+        };
+        /// \brief Decoded signals of a frame, the signals present in the frame in the order of IMessage::Signals()
+        class Values
+        {
+        public:
+            Values(const Value* begin, const Value* end)
+                : _begin(begin)
+                , _end(end)
+            {}
+            inline std::size_t Size() const noexcept { return _end - _begin; }
+            inline const Value& operator[](std::size_t i) const noexcept { return _begin[i]; }
+            inline const Value* begin() const noexcept { return _begin; }
+            inline const Value* end() const noexcept { return _end; }
+
+        private:
+            const Value* _begin;
+            const Value* _end;
+        };
+
+        /// @param capacity maximum number of cached frames, at least 1
+        static std::unique_ptr<IDecodeCache> Create(std::size_t capacity);
+
+        virtual ~IDecodeCache() = default;
+
+        /// \brief Returns the decoded frame from the cache or decodes and inserts it
+        ///
+        /// The key is (message, first max(8, MessageSize()) bytes of the frame).
+        /// !!! Note: bytes must fulfill the same requirements as for ISignal::Decode !!!
+        ///
+        /// @return valid until the next call of Decode or Clear
+        virtual Values Decode(const IMessage& message, const void* bytes) = 0;
+
+        virtual std::size_t Capacity() const = 0;
+        /// \brief Number of cached frames
+        virtual std::size_t Size() const = 0;
+        virtual uint64_t Hits() const = 0;
+        virtual uint64_t Misses() const = 0;
+        /// \brief Removes all entries and resets the counters
+        virtual void Clear() = 0;
+    };
+}
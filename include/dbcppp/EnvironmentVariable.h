@@ -3,6 +3,8 @@
 #include <map>
 #include <set>
 #include <string>
+#include <optional>
+#include <string_view>
 #include <vector>
 #include <cstddef>
 #include <functional>
@@ -64,6 +66,10 @@ namespace dbcppp
         virtual uint64_t AccessNodes_Size() const = 0;
         virtual const IValueEncodingDescription& ValueEncodingDescriptions_Get(std::size_t i) const = 0;
         virtual uint64_t ValueEncodingDescriptions_Size() const = 0;
+        /// \brief Description of the value encoding with the given value, std::nullopt if there is none
+        virtual std::optional<std::string_view> ValueToDescription(int64_t value) const = 0;
+        /// \brief Value of the value encoding with the given description, std::nullopt if there is none
+        virtual std::optional<int64_t> DescriptionToValue(std::string_view description) const = 0;
         virtual uint64_t DataSize() const = 0;
         virtual const IAttribute& AttributeValues_Get(std::size_t i) const = 0;
         virtual uint64_t AttributeValues_Size() const = 0;
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+#include "Export.h"
+#include "Message.h"
+
+namespace dbcppp
+{
+    /// \brief Long-lived frame of a message which is updated signal by signal
+    ///
+    /// Set only records the new raw value, Flush encodes each signal that was set since the last Flush
+    /// once with its last value. The frame is owned by the builder and can be handed to the driver
+    /// without copying it. Multiplexing is not considered, the switch has to be set like any other signal.
+    /// Overlapping signals (e.g. of different multiplexer branches) are encoded in the order they were
+    /// first set after the last Flush.
+    /// The message must outlive the builder.
+    class DBCPPP_API IFrameBuilder
+    {
+    public:
+        /// \brief Creates a builder whose frame starts as IMessage::Encode without values
+        static std::unique_ptr<IFrameBuilder> Create(const IMessage& message);
+
+        virtual ~IFrameBuilder() = default;
+
+        virtual const IMessage& Message() const = 0;
+
+        /// \brief Marks Message().Signals_Get(signal) dirty with the given raw value
+        ///
+        /// @return InvalidSignal if the index is out of range or the signal has an error (see ISignal::Error)
+        virtual IMessage::EEncodeError Set(std::size_t signal, ISignal::raw_t raw) = 0;
+        /// \brief Encodes the dirty signals into the frame
+        ///
+        /// @return the 64 bit words touched, bit i is set if bytes [8 * i, 8 * i + 8) were written,
+        ///         words behind the 64th aren't tracked
+        virtual uint64_t Flush() = 0;
+
+        /// \brief The frame as of the last Flush, stays valid as long as the builder lives
+        virtual const uint8_t* Data() const = 0;
+        /// \brief Size of the frame, max(8, Message().MessageSize())
+        virtual std::size_t Size() const = 0;
+    };
+}
@@ -22,6 +22,90 @@ namespace dbcppp
             NoError,
             MuxValeWithoutMuxSignal
         };
+        enum class EEncodeError
+        {
+            NoError,
+            /// the signal index is out of range or the signal has an error (see ISignal::Error)
+            InvalidSignal,
+            /// the signal isn't present for the multiplexer switch value(s) of the frame
+            SignalNotPresent,
+            /// the buffer is smaller than max(8, MessageSize()) bytes
+            BufferTooSmall
+        };
+        /// \brief Fixed-capacity result of Decode, holds the raw values of the signals present in a frame
+        class DecodeResult
+        {
+        public:
+            struct Entry
+            {
+                /// index of the signal in Signals()
+                uint32_t signal;
+                ISignal::raw_t raw;
+            };
+            /// number of 1 bit signals a 64 byte CAN FD frame can hold
+            static constexpr std::size_t Capacity = 512;
+
+            inline std::size_t Size() const noexcept { return _size; }
+            inline const Entry& operator[](std::size_t i) const noexcept { return _entries[i]; }
+            inline const Entry* begin() const noexcept { return _entries; }
+            inline const Entry* end() const noexcept { return _entries + _size; }
+            /// \brief More than Capacity signals were present, the remaining ones were dropped
+            inline bool Overflow() const noexcept { return _overflow; }
+
+            inline void Clear() noexcept
+            {
+                _size = 0;
+                _overflow = false;
+            }
+            inline void Push(uint32_t signal, ISignal::raw_t raw) noexcept
+            {
+                if (_size < Capacity)
+                {
+                    _entries[_size++] = {signal, raw};
+                }
+                else
+                {
+                    _overflow = true;
+                }
+            }
+
+        private:
+            std::size_t _size {0};
+            bool _overflow {false};
+            Entry _entries[Capacity];
+        };
+        /// \brief Previous frame of a stream of frames of one message, see DecodeChanges
+        class ChangeState
+        {
+        public:
+            /// frames are compared up to this size, signals reaching behind it are reported for every frame
+            static constexpr std::size_t MaxFrameSize = 64;
+
+            /// \brief Forgets the previous frame, the next DecodeChanges reports all present signals
+            inline void Reset() noexcept { _valid = false; }
+            inline bool Valid() const noexcept { return _valid; }
+
+        private:
+            friend class MessageImpl;
+
+            uint64_t _previous[MaxFrameSize / 8];
+            bool _valid {false};
+        };
+        /// \brief Output column of DecodeColumns
+        struct Column
+        {
+            /// index of the signal in Signals()
+            std::size_t signal;
+            /// output array, ISignal::raw_t values or double values if physical is set
+            void* values;
+            /// distance in bytes between two values, 0 for tightly packed values
+            std::size_t stride;
+            /// convert the raw values with RawToPhys
+            bool physical;
+            /// optional validity bitmap (may be nullptr), bit i % 8 of byte i / 8 is set if the signal
+            /// is present in frame i according to the multiplexing
+            uint8_t* validity;
+        };
 
         static std::unique_ptr<IMessage> Create(
               uint64_t id
@@ -61,5 +145,112 @@ namespace dbcppp
         virtual bool operator!=(const IMessage& message) const = 0;
 
         virtual EErrorCode Error() const = 0;
+
+        /// \brief Decode descriptors of all signals in one contiguous array,
+        ///        SignalDescriptors()[i] belongs to Signals_Get(i)
+        virtual const ISignal::Descriptor* SignalDescriptors() const = 0;
+
+        /// \brief Decodes the raw values of the signals present in the frame
+        ///
+        /// The multiplexer switch is decoded once and the present signals are taken from a table
+        /// built when the message is created. The entries are in the order of Signals().
+        /// !!! Note: bytes must fulfill the same requirements as for ISignal::Decode !!!
+        ///
+        /// @param bytes the frame data
+        /// @param result cleared and filled with the present signals
+        virtual void Decode(const void* bytes, DecodeResult& result) const = 0;
+        /// \brief Same as Decode(bytes, result), but never reads behind bytes + size
+        ///
+        /// The signals and multiplexer switches are decoded like ISignal::Decode(bytes, size), bytes missing
+        /// in the buffer are read as zero. So frames can be decoded straight from short or unpadded payloads
+        /// (e.g. DLC < 8 or CAN FD payloads) without copying them into a padded buffer first.
+        ///
+        /// @param bytes the frame data
+        /// @param size number of bytes of the frame data
+        /// @param result cleared and filled with the present signals
+        virtual void Decode(const void* bytes, std::size_t size, DecodeResult& result) const = 0;
+
+        /// \brief Decodes only the present signals whose bits changed since the previous frame
+        ///
+        /// The frame is xor-ed with the previous frame stored in state. A signal is reported if one of its bits
+        /// or one of the bits of the multiplexer switches it depends on changed, so a signal which becomes
+        /// present because the switch value changed is reported too. The first frame of a state reports all
+        /// present signals. Afterwards the frame is stored in state.
+        /// One state must only be used for frames of this message.
+        /// !!! Note: bytes must fulfill the same requirements as for ISignal::Decode !!!
+        ///
+        /// @param bytes the frame data
+        /// @param state previous frame, updated with bytes
+        /// @param result cleared and filled with the changed signals in the order of Signals()
+        virtual void DecodeChanges(const void* bytes, ChangeState& state, DecodeResult& result) const = 0;
+
+        /// \brief Builds a frame from a template and the given raw values
+        ///
+        /// The frame starts as the template for the selected multiplexer switch value, which holds the
+        /// GenSigStartValue of every signal present for it. Then the values are merged in. The switch value is
+        /// taken from values or, if it isn't contained, from its GenSigStartValue.
+        /// The entries of a DecodeResult can be passed back as values.
+        ///
+        /// @param values signals to set, the last entry wins if a signal is contained more than once
+        /// @param n number of values
+        /// @param buffer output frame
+        /// @param size size of buffer, must be at least max(8, MessageSize())
+        /// @return the first error, the content of the buffer is unspecified if it isn't NoError
+        virtual EEncodeError Encode(const DecodeResult::Entry* values, std::size_t n, void* buffer, std::size_t size) const = 0;
+
+        /// \brief Decodes the raw values of the signals of SignalGroups_Get(group) into one record
+        ///
+        /// The signal names of the group are resolved when the message is created and the signals are decoded
+        /// by a routine built for just them. values[i] is set to the value of the signal named SignalNames_Get(i)
+        /// of the group, or to 0 if the message has no signal with this name. Multiplexing is not considered.
+        /// !!! Note: bytes must fulfill the same requirements as for ISignal::Decode !!!
+        ///
+        /// @param group index of the signal group
+        /// @param bytes the frame data
+        /// @param values output record, must have room for SignalNames_Size() values of the group
+        virtual void DecodeSignalGroup(std::size_t group, const void* bytes, ISignal::raw_t* values) const = 0;
+
+        /// \brief Writes a record of raw values as decoded by DecodeSignalGroup into a frame
+        ///
+        /// Only the bits of the group's signals are changed, the rest of buffer is kept.
+        ///
+        /// @param group index of the signal group
+        /// @param values values[i] is written to the signal named SignalNames_Get(i) of the group
+        /// @param buffer frame to update
+        /// @param size size of buffer, must be at least max(8, MessageSize())
+        /// @return InvalidSignal if a signal of the group doesn't exist or has an error, buffer is unchanged then
+        virtual EEncodeError EncodeSignalGroup(std::size_t group, const ISignal::raw_t* values, void* buffer, std::size_t size) const = 0;
+
+        /// \brief Decodes count frames of this message into one column per selected signal
+        ///
+        /// Values of signals which are not present in a frame because of multiplexing are decoded
+        /// anyway, use the validity bitmap to filter them.
+        /// !!! Note: Each frame must fulfill the same requirements as the bytes passed to ISignal::Decode !!!
+        ///
+        /// @param frames pointer to the first frame
+        /// @param frame_stride distance in bytes between two consecutive frames
+        /// @param count number of frames
+        /// @param columns the signals to decode and where to store them
+        /// @param n_columns number of columns
+        virtual void DecodeColumns(const void* frames, std::size_t frame_stride, std::size_t count,
+            const Column* columns, std::size_t n_columns) const = 0;
+
+        /// \brief Decodes the raw values of all signals of this message
+        ///
+        /// values[i] is set to Signals_Get(i).Decode(bytes), multiplexing is not considered.
+        /// If the network was compiled with INetwork::CompileJit this runs a native routine
+        /// generated for the message.
+        /// !!! Note: bytes must fulfill the same requirements as for ISignal::Decode !!!
+        ///
+        /// @param bytes the frame data
+        /// @param values output array, must have room for Signals_Size() values
+        inline void DecodeSignals(const void* bytes, ISignal::raw_t* values) const noexcept
+        {
+            _decode_signals(this, bytes, values);
+        }
+
+    protected:
+        // instead of using virtuals dynamic dispatching use function pointers
+        void (*_decode_signals)(const IMessage* msg, const void* bytes, ISignal::raw_t* values) noexcept {nullptr};
     };
 }
\ No newline at end of file
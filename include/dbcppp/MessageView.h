@@ -0,0 +1,110 @@
+#pragma once
+
+#include <optional>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "Message.h"
+
+namespace dbcppp
+{
+    /// \brief Lazily decoding view of a frame
+    ///
+    /// Holds the message, a pointer to the payload and its length. A signal is decoded when it's accessed
+    /// for the first time, the value is kept in a small direct-mapped cache inside the view. The view never
+    /// allocates and is trivially copyable, so it can be stored in ring buffers. The payload isn't copied and
+    /// must outlive the view. Multiplexing is not considered.
+    /// The cache makes Raw non-const, a view must not be used by several threads at once.
+    /// The signals are decoded like ISignal::Decode(bytes, size), so the view never reads behind payload + length
+    /// and bytes missing in the payload are read as zero.
+    ///
+    /// @tparam aCacheSize number of cached values, at most 64
+    template <std::size_t aCacheSize = 8>
+    class BasicMessageView
+    {
+    public:
+        using raw_t = ISignal::raw_t;
+
+        static_assert(aCacheSize >= 1 && aCacheSize <= 64, "aCacheSize must be in [1, 64]");
+
+        /// \brief Precomputed reference to a signal, see Resolve
+        struct Handle
+        {
+            /// index of the signal in IMessage::Signals()
+            uint32_t index;
+        };
+
+        /// \brief Looks up a signal by name, meant to be done once outside of the hot path
+        static std::optional<Handle> Resolve(const IMessage& message, std::string_view name)
+        {
+            for (uint32_t i = 0; i < message.Signals_Size(); i++)
+            {
+                if (message.Signals_Get(i).Name() == name)
+                {
+                    return Handle{i};
+                }
+            }
+            return std::nullopt;
+        }
+
+        BasicMessageView(const IMessage& message, const void* payload, std::size_t length) noexcept
+            : _message(&message)
+            , _descriptors(message.SignalDescriptors())
+            , _payload(payload)
+            , _length(length)
+            , _valid(0)
+        {}
+
+        inline const IMessage& Message() const noexcept { return *_message; }
+        inline const void* Payload() const noexcept { return _payload; }
+        inline std::size_t Length() const noexcept { return _length; }
+
+        /// \brief Raw value of Message().Signals_Get(i)
+        inline raw_t Raw(std::size_t i) noexcept
+        {
+            const std::size_t slot = i % aCacheSize;
+            const uint64_t bit = 1ull << slot;
+            if ((_valid & bit) && _tags[slot] == i)
+            {
+                return _values[slot];
+            }
+            raw_t raw = _descriptors[i].Decode(_payload, _length);
+            _tags[slot] = uint32_t(i);
+            _values[slot] = raw;
+            _valid |= bit;
+            return raw;
+        }
+        inline raw_t Raw(Handle handle) noexcept
+        {
+            return Raw(handle.index);
+        }
+        /// \brief Physical value of Message().Signals_Get(i)
+        inline double Phys(std::size_t i) noexcept
+        {
+            return _message->Signals_Get(i).RawToPhys(Raw(i));
+        }
+        inline double Phys(Handle handle) noexcept
+        {
+            return Phys(handle.index);
+        }
+        /// \brief Points the view to another frame of the same message and drops the cached values
+        inline void Reset(const void* payload, std::size_t length) noexcept
+        {
+            _payload = payload;
+            _length = length;
+            _valid = 0;
+        }
+
+    private:
+        const IMessage* _message;
+        const ISignal::Descriptor* _descriptors;
+        const void* _payload;
+        std::size_t _length;
+        // bit i guards _tags[i] and _values[i]
+        uint64_t _valid;
+        uint32_t _tags[aCacheSize];
+        raw_t _values[aCacheSize];
+    };
+    using MessageView = BasicMessageView<>;
+}
@@ -4,6 +4,7 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include <optional>
 #include <istream>
 #include <functional>
 #include <unordered_map>
@@ -24,6 +25,15 @@ namespace dbcppp
     class DBCPPP_API INetwork
     {
     public:
+        /// \brief Position of a signal in the network
+        struct SignalHandle
+        {
+            /// index of the message in Messages()
+            uint32_t message;
+            /// index of the signal in Signals() of the message
+            uint32_t signal;
+        };
+
         static std::unique_ptr<INetwork> Create(
               std::string&& version
             , std::vector<std::string>&& new_symbols
@@ -75,11 +85,33 @@ namespace dbcppp
         DBCPPP_MAKE_ITERABLE(INetwork, AttributeDefaults, IAttribute);
         DBCPPP_MAKE_ITERABLE(INetwork, AttributeValues, IAttribute);
 
+        /// \brief Message the signal belongs to in constant time, nullptr if it isn't part of this network or sig is nullptr
         virtual const IMessage* ParentMessage(const ISignal* sig) const = 0;
+        /// \brief Index of the message in Messages() in constant time
+        virtual std::optional<std::size_t> MessageIndexOf(const IMessage* msg) const = 0;
+        /// \brief Handle of the signal in constant time
+        virtual std::optional<SignalHandle> SignalHandleOf(const ISignal* sig) const = 0;
+        virtual const ISignal& SignalByHandle(SignalHandle handle) const = 0;
+        /// \brief Finds a message by its id in constant time
+        ///
+        /// The id is compared to IMessage::Id(), which has bit 31 set for extended ids like in the DBC
+        /// file and like a SocketCAN can_id with CAN_EFF_FLAG. The RTR and error flags (bits 30 and 29)
+        /// are ignored for standard and extended ids, so a can_id can be passed as it is.
+        /// If several messages have the same id the first one is returned. The pseudo message
+        /// VECTOR__INDEPENDENT_SIG_MSG (id 0xC0000000) isn't a frame and is never returned.
+        ///
+        /// @return nullptr if there is no message with this id
+        virtual const IMessage* MessageById(uint64_t id) const = 0;
 
         virtual bool operator==(const INetwork& rhs) const = 0;
         virtual bool operator!=(const INetwork& rhs) const = 0;
 
         void Merge(std::unique_ptr<INetwork>&& other);
+
+        /// \brief Generates native x86-64 code for IMessage::DecodeSignals of all messages
+        ///
+        /// Returns false and keeps the portable implementation if the JIT is not available
+        /// (other architectures or built without build_jit).
+        bool CompileJit();
     };
 }
\ No newline at end of file
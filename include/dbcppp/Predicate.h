@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <string_view>
+
+#include "Export.h"
+#include "Message.h"
+
+namespace dbcppp
+{
+    /// \brief Filter on the signal values of a frame, evaluated on raw values
+    ///
+    /// Grammar:
+    ///     expression := or
+    ///     or         := and ("||" and)*
+    ///     and        := unary ("&&" unary)*
+    ///     unary      := "!" unary | "(" expression ")" | comparison
+    ///     comparison := signal_name ("==" | "!=" | "<" | "<=" | ">" | ">=") (number | 'label' | "label")
+    /// Numbers are finite physical values, nan and inf are rejected. When the predicate is created for a
+    /// message, each comparison with a number is converted into a range of raw values, using the signal's
+    /// factor, offset, bit size and value type. Labels are mapped to their raw value with the signal's
+    /// value descriptions (VAL_) and can only be compared with == and !=. Evaluate then compares the raw
+    /// values of a DecodeResult without calling RawToPhys. The ranges are exact: a raw value is in the
+    /// range if and only if RawToPhys of it fulfills the comparison. Float and double signals are compared
+    /// after RawToPhys. A comparison is false if the signal isn't present in the frame, if the message has
+    /// no signal with that name, or if the signal has no such label. This way one expression can be used
+    /// for all messages of a network.
+    class DBCPPP_API IPredicate
+    {
+    public:
+        /// \brief Parses expression and compiles it for message
+        ///
+        /// @param error set to a description of the syntax error if it isn't nullptr
+        /// @return nullptr if expression has a syntax error
+        static std::unique_ptr<IPredicate> Create(const IMessage& message, std::string_view expression, std::string* error = nullptr);
+
+        virtual ~IPredicate() = default;
+
+        virtual const IMessage& Message() const = 0;
+        /// \brief Evaluates the predicate on the result of Message().Decode
+        virtual bool Evaluate(const IMessage::DecodeResult& result) const = 0;
+    };
+}
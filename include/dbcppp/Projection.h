@@ -0,0 +1,64 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+#include "Export.h"
+#include "Network.h"
+
+namespace dbcppp
+{
+    /// \brief Decodes a fixed subset of the signals of a network
+    ///
+    /// The projected signals are the columns of the projection. When it's created the columns are grouped
+    /// by their message and the messages are put into a table indexed by message id, so a frame of a
+    /// message without projected signals is rejected with one lookup and only the projected signals
+    /// are decoded otherwise. Multiplexing is considered like in IMessage::Decode.
+    /// The network must outlive the projection and must not be changed (e.g. by INetwork::Merge) meanwhile.
+    class DBCPPP_API IProjection
+    {
+    public:
+        struct Value
+        {
+            /// index of the signal in Columns()
+            uint32_t column;
+            ISignal::raw_t raw;
+        };
+
+        /// \brief Projects the given signals, signals which aren't part of network are skipped
+        static std::unique_ptr<IProjection> Create(const INetwork& network, const std::vector<const ISignal*>& signals);
+        /// \brief Projects all signals of network with one of the given names
+        ///
+        /// Since signal names are only unique within a message a name can yield several columns,
+        /// they are in the order of the names and then of the messages.
+        static std::unique_ptr<IProjection> Create(const INetwork& network, const std::vector<std::string>& signal_names);
+
+        virtual ~IProjection() = default;
+
+        virtual const ISignal& Columns_Get(std::size_t i) const = 0;
+        virtual uint64_t Columns_Size() const = 0;
+        /// \brief Message the signal of column i belongs to
+        virtual const IMessage& ColumnMessage(std::size_t i) const = 0;
+
+        DBCPPP_MAKE_ITERABLE(IProjection, Columns, ISignal);
+
+        /// \brief Whether the first message of the network with this id has projected signals
+        virtual bool Covers(uint64_t message_id) const = 0;
+        /// \brief Maximum number of values Decode returns for one frame
+        virtual std::size_t MaxValues() const = 0;
+        /// \brief Decodes the projected signals present in a frame
+        ///
+        /// If several messages of the network have the same id the frame is decoded as the first one,
+        /// the columns of the other messages with this id are never decoded.
+        /// !!! Note: bytes must fulfill the same requirements as for ISignal::Decode !!!
+        ///
+        /// @param message_id id of the frame's message as returned by IMessage::Id()
+        /// @param bytes the frame data
+        /// @param values output, must have room for MaxValues() values, ordered by the signals' index in their message
+        /// @return number of values written, 0 if the message isn't covered
+        virtual std::size_t Decode(uint64_t message_id, const void* bytes, Value* values) const = 0;
+    };
+}
@@ -4,7 +4,10 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <optional>
+#include <string_view>
 #include <cstddef>
+#include <cstring>
 
 #include "Export.h"
 #include "Iterator.h"
@@ -44,6 +47,24 @@ namespace dbcppp
         {
             Integer, Float, Double
         };
+        enum class ESIMDLevel
+        {
+            None, SSE42, AVX2, AVX512
+        };
+
+        /// \brief Highest instruction set the vectorized batch kernels can use on this machine (detected via cpuid)
+        static ESIMDLevel SupportedSIMDLevel() noexcept;
+        /// \brief Instruction set used by the batch kernels of signals created from now on
+        static ESIMDLevel SIMDLevel() noexcept;
+        /// \brief Limits the instruction set used by the batch kernels of signals created after this call,
+        ///        levels above SupportedSIMDLevel() are clamped
+        static void SetSIMDLevel(ESIMDLevel level) noexcept;
+        /// \brief Lets integer signals created from now on with at most max_bit_size bits (up to 16) and a factor/offset
+        ///        precompute RawToPhys into a lookup table, as long as all tables together stay below memory_budget bytes.
+        ///        max_bit_size 0 disables the lookup tables (default)
+        static void SetRawToPhysLUT(uint64_t max_bit_size, std::size_t memory_budget) noexcept;
+        /// \brief Bytes currently allocated by the lookup tables of all signals
+        static std::size_t RawToPhysLUTMemory() noexcept;
         
         static std::unique_ptr<ISignal> Create(
               uint64_t message_size
@@ -85,6 +106,10 @@ namespace dbcppp
         virtual uint64_t Receivers_Size() const = 0;
         virtual const IValueEncodingDescription& ValueEncodingDescriptions_Get(std::size_t i) const = 0;
         virtual uint64_t ValueEncodingDescriptions_Size() const = 0;
+        /// \brief Description of the value encoding with the given value, std::nullopt if there is none
+        virtual std::optional<std::string_view> ValueToDescription(int64_t value) const = 0;
+        /// \brief Value of the value encoding with the given description, std::nullopt if there is none
+        virtual std::optional<int64_t> DescriptionToValue(std::string_view description) const = 0;
         virtual const IAttribute& AttributeValues_Get(std::size_t i) const = 0;
         virtual uint64_t AttributeValues_Size() const = 0;
         virtual const std::string& Comment() const = 0;
@@ -97,6 +122,44 @@ namespace dbcppp
         virtual bool operator==(const ISignal& rhs) const = 0;
         virtual bool operator!=(const ISignal& rhs) const = 0;
         
+        using raw_t = uint64_t;
+        /// \brief Packed copy of everything Decode needs, two descriptors fit into one cache line
+        ///
+        /// Hot loops iterating IMessage::SignalDescriptors() don't touch the signal objects
+        /// (names, units, attributes, ...) at all.
+        struct alignas(32) Descriptor
+        {
+            raw_t (*decode)(const Descriptor* desc, const void* bytes) noexcept;
+            uint64_t mask;
+            uint64_t mask_signed;
+            uint32_t byte_pos;
+            uint8_t fixed_start_bit_0;
+            uint8_t fixed_start_bit_1;
+            /// number of bytes decode reads from the start of the buffer
+            uint16_t decode_size;
+
+            /// \brief Same as ISignal::Decode of the signal the descriptor was created from
+            inline raw_t Decode(const void* bytes) const noexcept { return decode(this, bytes); }
+            /// \brief Same as ISignal::Decode(bytes, size) of the signal the descriptor was created from
+            inline raw_t Decode(const void* bytes, std::size_t size) const noexcept
+            {
+                if (size >= decode_size)
+                {
+                    return decode(this, bytes);
+                }
+                // decode reads one 8 (or 9) byte window starting at byte_pos, only signals
+                // inside the first 8 bytes always read the window at 0
+                std::size_t begin = decode_size == 8 ? 0 : byte_pos;
+                uint8_t window[16] = {};
+                if (size > begin)
+                {
+                    std::memcpy(window, reinterpret_cast<const uint8_t*>(bytes) + begin, size - begin);
+                }
+                Descriptor desc = *this;
+                desc.byte_pos -= uint32_t(begin);
+                return decode(&desc, window);
+            }
+        };
         /// \brief Extracts the raw value from a given n byte array
         ///
         /// This function uses a optimized method of reversing the byte order and extracting
@@ -111,12 +174,47 @@ namespace dbcppp
         ///               ...
         ///               bit_n-7 - bit_n: bytes[n / 8]
         ///               (like the Unix CAN frame does store the data)
-        using raw_t = uint64_t;
         inline raw_t Decode(const void* bytes) const noexcept { return _decode(this, bytes); }
+        /// \brief Extracts the raw value from a buffer of size bytes
+        ///
+        /// Never reads behind bytes + size, bytes missing in the buffer are read as zero. This allows
+        /// decoding directly from short or unpadded payloads (e.g. DLC < 8 or a CAN FD payload at the
+        /// end of a page). If the buffer covers all bytes Decode(bytes) reads, this costs only one compare.
+        inline raw_t Decode(const void* bytes, std::size_t size) const noexcept
+        {
+            return size >= _decode_size ? _decode(this, bytes) : _decode_partial(this, bytes, size);
+        }
+        /// \brief Writes the raw value into the buffer, leaving the bits of other signals untouched
+        ///
+        /// !!! Note: For messages of at least 8 bytes the buffer must hold at least 8 bytes and at least as many
+        ///     as the message has, for shorter messages it must hold at least the message's size !!!
         inline void Encode(raw_t raw, void* buffer) const noexcept { return _encode(this, raw, buffer); }
 
+        /// \brief Extracts the raw values of this signal from count frames
+        ///
+        /// Equivalent to calling Decode for each frame, but the kernel is selected once per batch
+        /// and the decode loop runs without any further dispatching.
+        /// !!! Note: Each frame must fulfill the same requirements as the bytes passed to Decode !!!
+        ///
+        /// @param nbytes pointer to the first frame
+        /// @param stride distance in bytes between two consecutive frames
+        /// @param count number of frames
+        /// @param values output array, must have room for count values
+        inline void DecodeBatch(const void* nbytes, std::size_t stride, std::size_t count, raw_t* values) const noexcept
+        {
+            _decode_batch(this, nbytes, stride, count, values);
+        }
+
         inline double RawToPhys(raw_t raw) const noexcept { return _raw_to_phys(this, raw); }
         inline raw_t PhysToRaw(double phys) const noexcept { return _phys_to_raw(this, phys); }
+
+        /// \brief Array versions of RawToPhys/PhysToRaw, the results are identical to calling the scalar
+        ///        functions for each element
+        ///
+        /// This includes physical values out of the range of an integer raw type: negative values wrap around
+        /// for unsigned signals, NaN and too large values become INT64_MIN (signed) or UINT64_MAX (unsigned).
+        inline void RawToPhysBatch(const raw_t* raw, double* phys, std::size_t n) const noexcept { _raw_to_phys_batch(this, raw, phys, n); }
+        inline void PhysToRawBatch(const double* phys, raw_t* raw, std::size_t n) const noexcept { _phys_to_raw_batch(this, phys, raw, n); }
         
         DBCPPP_MAKE_ITERABLE(ISignal, Receivers, std::string);
         DBCPPP_MAKE_ITERABLE(ISignal, ValueEncodingDescriptions, IValueEncodingDescription);
@@ -126,8 +224,14 @@ namespace dbcppp
     protected:
         // instead of using virtuals dynamic dispatching use function pointers
         raw_t (*_decode)(const ISignal* sig, const void* bytes) noexcept {nullptr};
+        raw_t (*_decode_partial)(const ISignal* sig, const void* bytes, std::size_t size) noexcept {nullptr};
+        // number of bytes _decode reads from the start of the buffer
+        std::size_t _decode_size {0};
+        void (*_decode_batch)(const ISignal* sig, const void* bytes, std::size_t stride, std::size_t count, raw_t* values) noexcept {nullptr};
         void (*_encode)(const ISignal* sig, raw_t raw, void* buffer) noexcept {nullptr};
         double (*_raw_to_phys)(const ISignal* sig, raw_t raw) noexcept {nullptr};
         raw_t (*_phys_to_raw)(const ISignal* sig, double phys) noexcept {nullptr};
+        void (*_raw_to_phys_batch)(const ISignal* sig, const raw_t* raw, double* phys, std::size_t n) noexcept {nullptr};
+        void (*_phys_to_raw_batch)(const ISignal* sig, const double* phys, raw_t* raw, std::size_t n) noexcept {nullptr};
     };
 }
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <array>
+#include <tuple>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+#include "Signal.h"
+
+namespace dbcppp
+{
+    /// \brief Signal with a layout known at compile time
+    ///
+    /// Header-only counterpart of ISignal::Decode/Encode. All masks and shifts are constants,
+    /// so the compiler can fold a decode into a load, a shift and a mask.
+    /// The bytes are assembled explicitly, which makes the result independent of the byte order
+    /// of the machine.
+    /// !!! Note: Like ISignal::Decode, Decode/Encode access the 8 bytes ending with the last byte of the signal,
+    ///     so the buffer must be at least 8 bytes long !!!
+    template <
+          uint64_t aStartBit
+        , uint64_t aBitSize
+        , ISignal::EByteOrder aByteOrder
+        , ISignal::EValueType aValueType
+        , ISignal::EExtendedValueType aExtendedValueType = ISignal::EExtendedValueType::Integer>
+    class StaticSignal
+    {
+    public:
+        using raw_t = ISignal::raw_t;
+
+        static constexpr uint64_t StartBit = aStartBit;
+        static constexpr uint64_t BitSize = aBitSize;
+        static constexpr ISignal::EByteOrder ByteOrder = aByteOrder;
+        static constexpr ISignal::EValueType ValueType = aValueType;
+        static constexpr ISignal::EExtendedValueType ExtendedValueType = aExtendedValueType;
+
+        static_assert(aBitSize >= 1 && aBitSize <= 64, "BitSize must be in [1, 64]");
+        static_assert(aExtendedValueType != ISignal::EExtendedValueType::Float || aBitSize == 32, "float signals must be 32 bit");
+        static_assert(aExtendedValueType != ISignal::EExtendedValueType::Double || aBitSize == 64, "double signals must be 64 bit");
+
+    private:
+        static constexpr uint64_t _first_byte = aStartBit / 8;
+        static constexpr uint64_t _nbytes = aByteOrder == ISignal::EByteOrder::LittleEndian
+            ? (aStartBit % 8 + aBitSize + 7) / 8
+            : (aBitSize + (7 - aStartBit % 8) + 7) / 8;
+        static constexpr uint64_t _last_byte = _first_byte + _nbytes - 1;
+        // the word is the 8 bytes ending with the last byte of the signal
+        static constexpr uint64_t _word_pos = _last_byte < 8 ? 0 : _last_byte - 7;
+        // the signal spans 9 bytes, the first one lies in front of the word
+        static constexpr bool _straddles = _nbytes > 8;
+        static constexpr uint64_t _mask = aBitSize == 64 ? ~0ull : (1ull << aBitSize) - 1;
+        static constexpr uint64_t _sign_bit = 1ull << (aBitSize - 1);
+
+        static constexpr uint64_t word_shift()
+        {
+            if constexpr (_straddles)
+            {
+                // LittleEndian: word holds the upper bits, BigEndian: word holds the lower bits at its top
+                return aByteOrder == ISignal::EByteOrder::LittleEndian
+                    ? 8 - aStartBit % 8
+                    : 64 - (aBitSize - (aStartBit % 8 + 1));
+            }
+            else if constexpr (aByteOrder == ISignal::EByteOrder::LittleEndian)
+            {
+                return aStartBit - _word_pos * 8;
+            }
+            else
+            {
+                return 8 * (7 - (_first_byte - _word_pos)) + aStartBit % 8 - (aBitSize - 1);
+            }
+        }
+        static constexpr uint64_t _word_shift = word_shift();
+        // BigEndian and straddling: number of signal bits in the word
+        static constexpr uint64_t _word_bits = 64 - _word_shift;
+
+        // written out so the compiler recognizes them as a single (byte swapping) load/store
+        static uint64_t load(const uint8_t* b) noexcept
+        {
+            if constexpr (aByteOrder == ISignal::EByteOrder::LittleEndian)
+            {
+                return uint64_t(b[0]) | (uint64_t(b[1]) << 8) | (uint64_t(b[2]) << 16) | (uint64_t(b[3]) << 24) |
+                    (uint64_t(b[4]) << 32) | (uint64_t(b[5]) << 40) | (uint64_t(b[6]) << 48) | (uint64_t(b[7]) << 56);
+            }
+            else
+            {
+                return (uint64_t(b[0]) << 56) | (uint64_t(b[1]) << 48) | (uint64_t(b[2]) << 40) | (uint64_t(b[3]) << 32) |
+                    (uint64_t(b[4]) << 24) | (uint64_t(b[5]) << 16) | (uint64_t(b[6]) << 8) | uint64_t(b[7]);
+            }
+        }
+        static void store(uint64_t value, uint8_t* b) noexcept
+        {
+            if constexpr (aByteOrder == ISignal::EByteOrder::LittleEndian)
+            {
+                b[0] = uint8_t(value);
+                b[1] = uint8_t(value >> 8);
+                b[2] = uint8_t(value >> 16);
+                b[3] = uint8_t(value >> 24);
+                b[4] = uint8_t(value >> 32);
+                b[5] = uint8_t(value >> 40);
+                b[6] = uint8_t(value >> 48);
+                b[7] = uint8_t(value >> 56);
+            }
+            else
+            {
+                b[0] = uint8_t(value >> 56);
+                b[1] = uint8_t(value >> 48);
+                b[2] = uint8_t(value >> 40);
+                b[3] = uint8_t(value >> 32);
+                b[4] = uint8_t(value >> 24);
+                b[5] = uint8_t(value >> 16);
+                b[6] = uint8_t(value >> 8);
+                b[7] = uint8_t(value);
+            }
+        }
+
+    public:
+        /// \brief Number of bytes the buffer passed to Decode/Encode must at least have
+        static constexpr uint64_t BufferSize = _word_pos + 8;
+
+        static raw_t Decode(const void* bytes) noexcept
+        {
+            const uint8_t* b = reinterpret_cast<const uint8_t*>(bytes);
+            uint64_t word = load(b + _word_pos);
+            uint64_t data;
+            if constexpr (_straddles && aByteOrder == ISignal::EByteOrder::LittleEndian)
+            {
+                data = (uint64_t(b[_first_byte]) >> (aStartBit % 8)) | (word << _word_shift);
+            }
+            else if constexpr (_straddles)
+            {
+                data = (uint64_t(b[_first_byte]) << _word_bits) | (word >> _word_shift);
+            }
+            else
+            {
+                data = word >> _word_shift;
+            }
+            data &= _mask;
+            if constexpr (aValueType == ISignal::EValueType::Signed &&
+                aExtendedValueType == ISignal::EExtendedValueType::Integer &&
+                aBitSize < 64)
+            {
+                data = (data ^ _sign_bit) - _sign_bit;
+            }
+            return data;
+        }
+        static void Encode(raw_t raw, void* buffer) noexcept
+        {
+            uint8_t* b = reinterpret_cast<uint8_t*>(buffer);
+            uint64_t word = load(b + _word_pos);
+            uint64_t word_mask;
+            uint64_t value;
+            if constexpr (_straddles && aByteOrder == ISignal::EByteOrder::LittleEndian)
+            {
+                constexpr uint8_t byte_mask = uint8_t(_mask << (aStartBit % 8));
+                b[_first_byte] = uint8_t((b[_first_byte] & ~byte_mask) | ((raw << (aStartBit % 8)) & byte_mask));
+                word_mask = _mask >> _word_shift;
+                value = raw >> _word_shift;
+            }
+            else if constexpr (_straddles)
+            {
+                constexpr uint8_t byte_mask = uint8_t(_mask >> _word_bits);
+                b[_first_byte] = uint8_t((b[_first_byte] & ~byte_mask) | ((raw >> _word_bits) & byte_mask));
+                word_mask = _mask << _word_shift;
+                value = raw << _word_shift;
+            }
+            else
+            {
+                word_mask = _mask << _word_shift;
+                value = raw << _word_shift;
+            }
+            store((word & ~word_mask) | (value & word_mask), b + _word_pos);
+        }
+    };
+
+    /// \brief Message consisting of StaticSignals
+    ///
+    /// @tparam aId message id
+    /// @tparam aMessageSize message size in bytes
+    /// @tparam aSignals StaticSignal types of the signals
+    template <uint64_t aId, uint64_t aMessageSize, class... aSignals>
+    class StaticMessage
+    {
+    public:
+        using raw_t = ISignal::raw_t;
+
+        static constexpr uint64_t Id = aId;
+        static constexpr uint64_t MessageSize = aMessageSize;
+        static constexpr std::size_t SignalCount = sizeof...(aSignals);
+
+        template <std::size_t I>
+        using Signal = std::tuple_element_t<I, std::tuple<aSignals...>>;
+
+        static_assert(((aSignals::BufferSize <= (aMessageSize < 8 ? 8 : aMessageSize)) && ...),
+            "signal exceeds message size");
+
+        /// \brief Decodes the I-th signal
+        template <std::size_t I>
+        static raw_t Decode(const void* bytes) noexcept
+        {
+            return Signal<I>::Decode(bytes);
+        }
+        /// \brief Decodes all signals in the order they are given in aSignals
+        static std::array<raw_t, SignalCount> Decode(const void* bytes) noexcept
+        {
+            return {aSignals::Decode(bytes)...};
+        }
+        /// \brief Encodes all signals, values must be in the order of aSignals
+        static void Encode(const std::array<raw_t, SignalCount>& values, void* buffer) noexcept
+        {
+            encode(values, buffer, std::index_sequence_for<aSignals...>{});
+        }
+
+    private:
+        template <std::size_t... I>
+        static void encode(const std::array<raw_t, SignalCount>& values, void* buffer, std::index_sequence<I...>) noexcept
+        {
+            (aSignals::Encode(values[I], buffer), ...);
+        }
+    };
+}
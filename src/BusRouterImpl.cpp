@@ -0,0 +1,75 @@
+#include "BusRouterImpl.h"
+
+using namespace dbcppp;
+
+std::unique_ptr<IBusRouter> IBusRouter::Create()
+{
+    return std::make_unique<BusRouterImpl>();
+}
+void BusRouterImpl::SetBus(std::size_t bus, const INetwork* network)
+{
+    if (bus >= _buses.size())
+    {
+        _buses.resize(bus + 1, {nullptr, 0});
+    }
+    // NetworkImpl is the only implementation of INetwork
+    _buses[bus].network = static_cast<const NetworkImpl*>(network);
+}
+const INetwork* BusRouterImpl::Bus(std::size_t bus) const
+{
+    return bus < _buses.size() ? _buses[bus].network : nullptr;
+}
+std::size_t BusRouterImpl::Buses_Size() const
+{
+    return _buses.size();
+}
+const IMessage* BusRouterImpl::Route(std::size_t bus, uint64_t id)
+{
+    if (bus >= _buses.size() || !_buses[bus].network)
+    {
+        _unknown_bus++;
+        return nullptr;
+    }
+    BusEntry& entry = _buses[bus];
+    // qualified, so the lookup is a direct call instead of a virtual one
+    const IMessage* msg = entry.network->NetworkImpl::MessageById(id);
+    if (msg)
+    {
+        _routed++;
+    }
+    else
+    {
+        entry.unrouted++;
+    }
+    return msg;
+}
+uint64_t BusRouterImpl::Routed() const
+{
+    return _routed;
+}
+uint64_t BusRouterImpl::Unrouted() const
+{
+    uint64_t unrouted = _unknown_bus;
+    for (const auto& entry : _buses)
+    {
+        unrouted += entry.unrouted;
+    }
+    return unrouted;
+}
+uint64_t BusRouterImpl::Unrouted(std::size_t bus) const
+{
+    return bus < _buses.size() ? _buses[bus].unrouted : 0;
+}
+uint64_t BusRouterImpl::UnknownBus() const
+{
+    return _unknown_bus;
+}
+void BusRouterImpl::ResetCounters()
+{
+    for (auto& entry : _buses)
+    {
+        entry.unrouted = 0;
+    }
+    _routed = 0;
+    _unknown_bus = 0;
+}
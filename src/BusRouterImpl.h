@@ -0,0 +1,38 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include "dbcppp/BusRouter.h"
+#include "NetworkImpl.h"
+
+namespace dbcppp
+{
+    class BusRouterImpl final
+        : public IBusRouter
+    {
+    public:
+        virtual void SetBus(std::size_t bus, const INetwork* network) override;
+        virtual const INetwork* Bus(std::size_t bus) const override;
+        virtual std::size_t Buses_Size() const override;
+
+        virtual const IMessage* Route(std::size_t bus, uint64_t id) override;
+
+        virtual uint64_t Routed() const override;
+        virtual uint64_t Unrouted() const override;
+        virtual uint64_t Unrouted(std::size_t bus) const override;
+        virtual uint64_t UnknownBus() const override;
+        virtual void ResetCounters() override;
+
+    private:
+        struct BusEntry
+        {
+            const NetworkImpl* network;
+            uint64_t unrouted;
+        };
+
+        std::vector<BusEntry> _buses;
+        uint64_t _routed = 0;
+        uint64_t _unknown_bus = 0;
+    };
+}
@@ -688,6 +688,11 @@ extern "C"
         auto neti = reinterpret_cast<const NetworkImpl*>(net);
         return neti->Messages_Size();
     }
+    DBCPPP_API const dbcppp_Message* dbcppp_NetworkMessageById(const dbcppp_Network* net, uint64_t id)
+    {
+        auto neti = reinterpret_cast<const NetworkImpl*>(net);
+        return reinterpret_cast<const dbcppp_Message*>(neti->MessageById(id));
+    }
     DBCPPP_API const dbcppp_EnvironmentVariable* dbcppp_NetworkEnvironmentVariables_Get(const dbcppp_Network* net, uint64_t i)
     {
         auto neti = reinterpret_cast<const NetworkImpl*>(net);
@@ -1007,6 +1012,16 @@ extern "C"
         auto sigi = reinterpret_cast<const SignalImpl*>(sig);
         return sigi->Decode(bytes);
     }
+    DBCPPP_API uint64_t dbcppp_SignalDecodeSized(const dbcppp_Signal* sig, const void* bytes, uint64_t size)
+    {
+        auto sigi = reinterpret_cast<const SignalImpl*>(sig);
+        return sigi->Decode(bytes, size);
+    }
+    DBCPPP_API void dbcppp_SignalDecodeBatch(const dbcppp_Signal* sig, const void* bytes, uint64_t stride, uint64_t count, uint64_t* values)
+    {
+        auto sigi = reinterpret_cast<const SignalImpl*>(sig);
+        sigi->DecodeBatch(bytes, stride, count, values);
+    }
     DBCPPP_API void dbcppp_SignalEncode(const dbcppp_Signal* sig, uint64_t raw, void* buffer)
     {
         auto sigi = reinterpret_cast<const SignalImpl*>(sig);
@@ -1022,6 +1037,16 @@ extern "C"
         auto sigi = reinterpret_cast<const SignalImpl*>(sig);
         return sigi->PhysToRaw(phys);
     }
+    DBCPPP_API void dbcppp_SignalRawToPhysBatch(const dbcppp_Signal* sig, const uint64_t* raw, double* phys, uint64_t n)
+    {
+        auto sigi = reinterpret_cast<const SignalImpl*>(sig);
+        sigi->RawToPhysBatch(raw, phys, n);
+    }
+    DBCPPP_API void dbcppp_SignalPhysToRawBatch(const dbcppp_Signal* sig, const double* phys, uint64_t* raw, uint64_t n)
+    {
+        auto sigi = reinterpret_cast<const SignalImpl*>(sig);
+        sigi->PhysToRawBatch(phys, raw, n);
+    }
 
     DBCPPP_API const dbcppp_SignalType* dbcppp_SignalTypeCreate(
           const char* name
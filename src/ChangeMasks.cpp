@@ -0,0 +1,124 @@
+#include <cstring>
+#include <unordered_map>
+#include "ChangeMasks.h"
+
+using namespace dbcppp;
+
+namespace
+{
+    // sets the bits of the signal in bits, returns false if the signal reaches behind the frame
+    bool cover(const SignalImpl& sig, uint8_t* bits)
+    {
+        uint64_t pos = sig.StartBit();
+        for (uint64_t i = 0; i < sig.BitSize(); i++)
+        {
+            if (pos / 8 >= ChangeMasks::max_frame_size)
+            {
+                return false;
+            }
+            bits[pos / 8] |= uint8_t(1u << (pos % 8));
+            if (sig.ByteOrder() == ISignal::EByteOrder::LittleEndian)
+            {
+                pos++;
+            }
+            // big endian signals continue with the most significant bit of the next byte
+            else if (pos % 8 == 0)
+            {
+                pos += 15;
+            }
+            else
+            {
+                pos--;
+            }
+        }
+        return true;
+    }
+}
+
+ChangeMasks::ChangeMasks(const std::vector<SignalImpl>& signals)
+{
+    std::unordered_map<std::string, uint32_t> names;
+    uint32_t mux_switch = uint32_t(-1);
+    for (uint32_t i = 0; i < signals.size(); i++)
+    {
+        names.emplace(signals[i].Name(), i);
+        if (signals[i].MultiplexerIndicator() == ISignal::EMultiplexer::MuxSwitch)
+        {
+            // like MessageImpl::MuxSignal() the last switch wins
+            mux_switch = i;
+        }
+    }
+    for (uint32_t i = 0; i < signals.size(); i++)
+    {
+        uint8_t bits[max_frame_size] = {};
+        bool always = false;
+        // the signal and (transitively) its switches, a switch that was already added ends a cycle
+        std::vector<uint32_t> todo{i};
+        std::vector<bool> added(signals.size(), false);
+        added[i] = true;
+        while (!todo.empty())
+        {
+            const SignalImpl& sig = signals[todo.back()];
+            todo.pop_back();
+            always |= !cover(sig, bits);
+            if (sig.MultiplexerIndicator() != ISignal::EMultiplexer::MuxValue)
+            {
+                continue;
+            }
+            auto add =
+                [&](uint32_t sw)
+                {
+                    if (!added[sw])
+                    {
+                        added[sw] = true;
+                        todo.push_back(sw);
+                    }
+                };
+            if (sig.SignalMultiplexerValues_Size() == 0 && mux_switch != uint32_t(-1))
+            {
+                add(mux_switch);
+            }
+            for (const auto& smv : sig.SignalMultiplexerValues())
+            {
+                auto iter = names.find(smv.SwitchName());
+                if (iter != names.end())
+                {
+                    add(iter->second);
+                }
+            }
+        }
+        Signal s{uint32_t(_words.size()), 0, always};
+        for (uint32_t w = 0; w < max_frame_size / 8; w++)
+        {
+            uint64_t mask;
+            std::memcpy(&mask, &bits[w * 8], 8);
+            if (mask)
+            {
+                _words.push_back({w, mask});
+            }
+        }
+        s.end = uint32_t(_words.size());
+        _complete &= !always;
+        _signals.push_back(s);
+    }
+}
+bool ChangeMasks::changed(std::size_t signal, const uint64_t* diff) const noexcept
+{
+    const Signal& s = _signals[signal];
+    if (s.always)
+    {
+        return true;
+    }
+    for (uint32_t i = s.begin; i < s.end; i++)
+    {
+        if (diff[_words[i].index] & _words[i].mask)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+bool ChangeMasks::complete() const noexcept
+{
+    return _complete;
+}
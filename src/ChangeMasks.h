@@ -0,0 +1,44 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include "dbcppp/Message.h"
+#include "SignalImpl.h"
+
+namespace dbcppp
+{
+    // Per signal the bits of the frame which decide its value: its own bits and the bits of the
+    // multiplexer switches it depends on. The masks are in memory order, so a 64 bit word of the mask
+    // can be and-ed with the xor of two frames loaded the same way.
+    class ChangeMasks
+    {
+    public:
+        static constexpr std::size_t max_frame_size = IMessage::ChangeState::MaxFrameSize;
+
+        ChangeMasks() = default;
+        ChangeMasks(const std::vector<SignalImpl>& signals);
+
+        // diff holds max_frame_size / 8 words
+        bool changed(std::size_t signal, const uint64_t* diff) const noexcept;
+        // no signal reaches behind max_frame_size, so an unchanged frame has no changed signals
+        bool complete() const noexcept;
+
+    private:
+        struct Word
+        {
+            uint32_t index;
+            uint64_t mask;
+        };
+        struct Signal
+        {
+            uint32_t begin;
+            uint32_t end;
+            bool always;
+        };
+
+        std::vector<Signal> _signals;
+        std::vector<Word> _words;
+        bool _complete {true};
+    };
+}
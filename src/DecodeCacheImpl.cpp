@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <cstring>
+#include "DecodeCacheImpl.h"
+
+using namespace dbcppp;
+
+namespace
+{
+    uint64_t hash_frame(uint64_t id, const uint8_t* payload, std::size_t size)
+    {
+        constexpr uint64_t k = 0x9E3779B97F4A7C15ull;
+        uint64_t h = (id + 1) * k;
+        for (std::size_t i = 0; i < size; i += 8)
+        {
+            uint64_t word = 0;
+            std::memcpy(&word, payload + i, std::min<std::size_t>(8, size - i));
+            h = (h ^ word) * k;
+            h ^= h >> 32;
+        }
+        return h;
+    }
+}
+
+std::unique_ptr<IDecodeCache> IDecodeCache::Create(std::size_t capacity)
+{
+    return std::make_unique<DecodeCacheImpl>(capacity);
+}
+DecodeCacheImpl::DecodeCacheImpl(std::size_t capacity)
+    : _capacity(std::max<std::size_t>(capacity, 1))
+    , _hand(0)
+    , _hits(0)
+    , _misses(0)
+{
+    // keep the load factor at or below 0.5
+    std::size_t table_size = 1;
+    while (table_size < 2 * _capacity)
+    {
+        table_size *= 2;
+    }
+    _table.assign(table_size, empty);
+    _table_mask = table_size - 1;
+    _slots.reserve(_capacity);
+}
+IDecodeCache::Values DecodeCacheImpl::Decode(const IMessage& message, const void* bytes)
+{
+    const uint8_t* payload = reinterpret_cast<const uint8_t*>(bytes);
+    const std::size_t size = std::max<uint64_t>(message.MessageSize(), 8);
+    const uint64_t hash = hash_frame(message.Id(), payload, size);
+    uint64_t pos = hash & _table_mask;
+    for (; _table[pos] != empty; pos = (pos + 1) & _table_mask)
+    {
+        Slot& slot = _slots[_table[pos]];
+        if (slot.hash == hash && slot.message == &message &&
+            slot.payload.size() == size && std::memcmp(slot.payload.data(), payload, size) == 0)
+        {
+            _hits++;
+            slot.referenced = true;
+            return {slot.values.data(), slot.values.data() + slot.values.size()};
+        }
+    }
+    _misses++;
+    uint32_t index = allocate();
+    Slot& slot = _slots[index];
+    slot.message = &message;
+    slot.hash = hash;
+    slot.payload.assign(payload, payload + size);
+    slot.referenced = false;
+    slot.values.clear();
+    message.Decode(bytes, _result);
+    for (const auto& entry : _result)
+    {
+        const ISignal& sig = message.Signals_Get(entry.signal);
+        slot.values.push_back({entry.signal, entry.raw, sig.RawToPhys(entry.raw), sig.ValueToDescription(int64_t(entry.raw))});
+    }
+    // the eviction might have closed the gap at pos, so search again
+    pos = hash & _table_mask;
+    while (_table[pos] != empty)
+    {
+        pos = (pos + 1) & _table_mask;
+    }
+    _table[pos] = index;
+    return {slot.values.data(), slot.values.data() + slot.values.size()};
+}
+uint32_t DecodeCacheImpl::allocate()
+{
+    if (_slots.size() < _capacity)
+    {
+        _slots.emplace_back();
+        return uint32_t(_slots.size() - 1);
+    }
+    // give every recently used entry a second chance
+    while (_slots[_hand].referenced)
+    {
+        _slots[_hand].referenced = false;
+        _hand = (_hand + 1) % _slots.size();
+    }
+    uint32_t victim = uint32_t(_hand);
+    _hand = (_hand + 1) % _slots.size();
+    erase(victim);
+    return victim;
+}
+void DecodeCacheImpl::erase(uint32_t slot)
+{
+    uint64_t pos = _slots[slot].hash & _table_mask;
+    while (_table[pos] != slot)
+    {
+        pos = (pos + 1) & _table_mask;
+    }
+    // move entries of the probe sequence behind the gap into it if their home position allows it
+    uint64_t next = pos;
+    while (true)
+    {
+        next = (next + 1) & _table_mask;
+        if (_table[next] == empty)
+        {
+            break;
+        }
+        uint64_t home = _slots[_table[next]].hash & _table_mask;
+        bool movable = pos <= next
+            ? home <= pos || home > next
+            : home <= pos && home > next;
+        if (movable)
+        {
+            _table[pos] = _table[next];
+            pos = next;
+        }
+    }
+    _table[pos] = empty;
+}
+std::size_t DecodeCacheImpl::Capacity() const
+{
+    return _capacity;
+}
+std::size_t DecodeCacheImpl::Size() const
+{
+    return _slots.size();
+}
+uint64_t DecodeCacheImpl::Hits() const
+{
+    return _hits;
+}
+uint64_t DecodeCacheImpl::Misses() const
+{
+    return _misses;
+}
+void DecodeCacheImpl::Clear()
+{
+    _slots.clear();
+    std::fill(_table.begin(), _table.end(), empty);
+    _hand = 0;
+    _hits = 0;
+    _misses = 0;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include "dbcppp/DecodeCache.h"
+
+namespace dbcppp
+{
+    class DecodeCacheImpl final
+        : public IDecodeCache
+    {
+    public:
+        DecodeCacheImpl(std::size_t capacity);
+
+        virtual Values Decode(const IMessage& message, const void* bytes) override;
+
+        virtual std::size_t Capacity() const override;
+        virtual std::size_t Size() const override;
+        virtual uint64_t Hits() const override;
+        virtual uint64_t Misses() const override;
+        virtual void Clear() override;
+
+    private:
+        struct Slot
+        {
+            const IMessage* message;
+            uint64_t hash;
+            std::vector<uint8_t> payload;
+            // the vectors keep their capacity when the slot is reused
+            std::vector<Value> values;
+            // CLOCK reference bit, set on every hit
+            bool referenced;
+        };
+        static constexpr uint32_t empty = uint32_t(-1);
+
+        // returns the slot to insert into, evicts an entry if the cache is full
+        uint32_t allocate();
+        // removes the slot from _table, closing the gap so that no tombstones are needed
+        void erase(uint32_t slot);
+
+        std::vector<Slot> _slots;
+        std::size_t _capacity;
+        // CLOCK hand
+        std::size_t _hand;
+        // open addressing with linear probing, holds slot indices or empty
+        std::vector<uint32_t> _table;
+        uint64_t _table_mask;
+        uint64_t _hits;
+        uint64_t _misses;
+        IMessage::DecodeResult _result;
+    };
+}
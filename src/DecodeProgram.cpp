@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <numeric>
+#include "Helper.h"
+#include "DecodeProgram.h"
+
+using namespace dbcppp;
+
+DecodeProgram::DecodeProgram(const std::vector<SignalImpl>& signals)
+    : DecodeProgram(signals,
+        [&]
+        {
+            std::vector<uint32_t> all(signals.size());
+            std::iota(all.begin(), all.end(), 0);
+            return all;
+        }())
+{}
+DecodeProgram::DecodeProgram(const std::vector<SignalImpl>& signals, const std::vector<uint32_t>& selection)
+{
+    auto word_pos =
+        [](const SignalImpl& sig) -> uint64_t
+        {
+            return sig._alignment == Alignment::size_inbetween_first_64_bit ? 0 : sig._byte_pos;
+        };
+    auto straddles =
+        [](const SignalImpl& sig)
+        {
+            return sig._alignment == Alignment::signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit;
+        };
+    std::vector<uint32_t> order;
+    for (uint32_t i = 0; i < selection.size(); i++)
+    {
+        if (selection[i] == uint32_t(-1))
+        {
+            continue;
+        }
+        // the shifts of broken signals can be out of range
+        if (signals[selection[i]].Error(ISignal::EErrorCode::NoError))
+        {
+            order.push_back(i);
+        }
+        else
+        {
+            _fallbacks.push_back({selection[i], i});
+        }
+    }
+    std::stable_sort(order.begin(), order.end(),
+        [&](uint32_t lhs, uint32_t rhs)
+        {
+            const auto& l = signals[selection[lhs]];
+            const auto& r = signals[selection[rhs]];
+            if (word_pos(l) != word_pos(r))
+            {
+                return word_pos(l) < word_pos(r);
+            }
+            if (l.ByteOrder() != r.ByteOrder())
+            {
+                return l.ByteOrder() < r.ByteOrder();
+            }
+            return !straddles(l) && straddles(r);
+        });
+    for (auto i : order)
+    {
+        const SignalImpl& sig = signals[selection[i]];
+        if (_words.empty() || _words.back().byte_pos != word_pos(sig) || _words.back().byte_order != sig.ByteOrder())
+        {
+            uint32_t begin = uint32_t(_fields.size());
+            _words.push_back({word_pos(sig), sig.ByteOrder(), begin, begin, begin});
+        }
+        Word& word = _words.back();
+        uint64_t bit_size = sig.BitSize();
+        Field field;
+        field.index = i;
+        field.shift_right = uint8_t(64 - bit_size);
+        field.mask = bit_size == 64 ? ~0ull : (1ull << bit_size) - 1;
+        if (sig.ValueType() == ISignal::EValueType::Signed &&
+            sig.ExtendedValueType() == ISignal::EExtendedValueType::Integer)
+        {
+            field.mask = ~0ull;
+        }
+        if (straddles(sig))
+        {
+            field.shift_left = uint8_t(64 - bit_size);
+            field.shift_word = uint8_t(sig._fixed_start_bit_0);
+            field.shift_byte = uint8_t(sig._fixed_start_bit_1);
+        }
+        else
+        {
+            // move the signal to the top of the word, so the right shift masks and sign extends at once
+            field.shift_left = uint8_t(64 - sig._fixed_start_bit_0 - bit_size);
+            field.shift_word = 0;
+            field.shift_byte = 0;
+            word.end_fits++;
+        }
+        _fields.push_back(field);
+        word.end++;
+    }
+}
+void DecodeProgram::execute(const ISignal::Descriptor* descriptors, const void* bytes, ISignal::raw_t* values) const noexcept
+{
+    const uint8_t* b = reinterpret_cast<const uint8_t*>(bytes);
+    const Field* fields = _fields.data();
+    for (const auto& word : _words)
+    {
+        uint64_t data = *reinterpret_cast<const uint64_t*>(&b[word.byte_pos]);
+        if (word.byte_order == ISignal::EByteOrder::BigEndian)
+        {
+            native_to_big_inplace(data);
+        }
+        else
+        {
+            native_to_little_inplace(data);
+        }
+        for (uint32_t i = word.begin; i < word.end_fits; i++)
+        {
+            const Field& f = fields[i];
+            values[f.index] = uint64_t(int64_t(data << f.shift_left) >> f.shift_right) & f.mask;
+        }
+        for (uint32_t i = word.end_fits; i < word.end; i++)
+        {
+            const Field& f = fields[i];
+            uint64_t byte = b[word.byte_pos + 8];
+            uint64_t value;
+            if (word.byte_order == ISignal::EByteOrder::BigEndian)
+            {
+                value = (data << f.shift_word) | (byte >> f.shift_byte);
+            }
+            else
+            {
+                value = (data >> f.shift_word) | (byte << f.shift_byte);
+            }
+            values[f.index] = uint64_t(int64_t(value << f.shift_left) >> f.shift_right) & f.mask;
+        }
+    }
+    for (const auto& fallback : _fallbacks)
+    {
+        values[fallback.index] = descriptors[fallback.signal].Decode(bytes);
+    }
+}
+const std::vector<DecodeProgram::Word>& DecodeProgram::words() const
+{
+    return _words;
+}
+const std::vector<DecodeProgram::Field>& DecodeProgram::fields() const
+{
+    return _fields;
+}
+const std::vector<DecodeProgram::Fallback>& DecodeProgram::fallbacks() const
+{
+    return _fallbacks;
+}
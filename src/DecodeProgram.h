@@ -0,0 +1,65 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include "SignalImpl.h"
+
+namespace dbcppp
+{
+    // Decode routine of a whole message. The signals are grouped by the 64 bit word they are
+    // extracted from, so each word is loaded and byte swapped once and then fanned out into its fields.
+    class DecodeProgram
+    {
+    public:
+        struct Field
+        {
+            // index of the value in the output array
+            uint32_t index;
+            // value = ((word << shift_left) >> shift_right) & mask, where the right shift is arithmetic,
+            // mask is ~0 for signed integers and the signal's bits otherwise
+            uint8_t shift_left;
+            uint8_t shift_right;
+            // straddling fields only: shifts of the word and the 9th byte before they are combined
+            uint8_t shift_word;
+            uint8_t shift_byte;
+            uint64_t mask;
+        };
+        struct Word
+        {
+            uint64_t byte_pos;
+            ISignal::EByteOrder byte_order;
+            // fields [begin, end_fits) are completely inside the word,
+            // fields [end_fits, end) straddle into the byte behind the word
+            uint32_t begin;
+            uint32_t end_fits;
+            uint32_t end;
+        };
+
+        struct Fallback
+        {
+            // index of the signal in the message
+            uint32_t signal;
+            // index of the value in the output array
+            uint32_t index;
+        };
+
+        DecodeProgram() = default;
+        // decodes signals[i] into values[i]
+        DecodeProgram(const std::vector<SignalImpl>& signals);
+        // decodes signals[selection[i]] into values[i], values[i] isn't touched if selection[i] is uint32_t(-1)
+        DecodeProgram(const std::vector<SignalImpl>& signals, const std::vector<uint32_t>& selection);
+
+        void execute(const ISignal::Descriptor* descriptors, const void* bytes, ISignal::raw_t* values) const noexcept;
+
+        const std::vector<Word>& words() const;
+        const std::vector<Field>& fields() const;
+        // signals which couldn't be compiled (because they have errors) and are decoded with their descriptor
+        const std::vector<Fallback>& fallbacks() const;
+
+    private:
+        std::vector<Word> _words;
+        std::vector<Field> _fields;
+        std::vector<Fallback> _fallbacks;
+    };
+}
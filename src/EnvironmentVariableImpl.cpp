@@ -73,6 +73,7 @@ EnvironmentVariableImpl::EnvironmentVariableImpl(
     , _access_type(std::move(access_type))
     , _access_nodes(std::move(access_nodes))
     , _value_encoding_descriptions(std::move(value_encoding_descriptions))
+    , _value_encoding_index(_value_encoding_descriptions)
     , _data_size(std::move(data_size))
     , _attribute_values(std::move(attribute_values))
     , _comment(std::move(comment))
@@ -129,6 +130,14 @@ uint64_t EnvironmentVariableImpl::ValueEncodingDescriptions_Size() const
 {
     return _value_encoding_descriptions.size();
 }
+std::optional<std::string_view> EnvironmentVariableImpl::ValueToDescription(int64_t value) const
+{
+    return _value_encoding_index.find(_value_encoding_descriptions, value);
+}
+std::optional<int64_t> EnvironmentVariableImpl::DescriptionToValue(std::string_view description) const
+{
+    return _value_encoding_index.find(_value_encoding_descriptions, description);
+}
 uint64_t EnvironmentVariableImpl::DataSize() const
 {
     return _data_size;
@@ -4,6 +4,7 @@
 #include "NodeImpl.h"
 #include "AttributeImpl.h"
 #include "ValueEncodingDescriptionImpl.h"
+#include "ValueEncodingIndex.h"
 
 namespace dbcppp
 {
@@ -40,6 +41,8 @@ namespace dbcppp
         virtual uint64_t AccessNodes_Size() const override;
         virtual const IValueEncodingDescription& ValueEncodingDescriptions_Get(std::size_t i) const override;
         virtual uint64_t ValueEncodingDescriptions_Size() const override;
+        virtual std::optional<std::string_view> ValueToDescription(int64_t value) const override;
+        virtual std::optional<int64_t> DescriptionToValue(std::string_view description) const override;
         virtual uint64_t DataSize() const override;
         virtual const IAttribute& AttributeValues_Get(std::size_t i) const override;
         virtual uint64_t AttributeValues_Size() const override;
@@ -59,6 +62,7 @@ namespace dbcppp
         EAccessType _access_type;
         std::vector<std::string> _access_nodes;
         std::vector<ValueEncodingDescriptionImpl> _value_encoding_descriptions;
+        ValueEncodingIndex _value_encoding_index;
         uint64_t _data_size;
         std::vector<AttributeImpl> _attribute_values;
         std::string _comment;
@@ -0,0 +1,73 @@
+#include <algorithm>
+#include "FrameBuilderImpl.h"
+
+using namespace dbcppp;
+
+std::unique_ptr<IFrameBuilder> IFrameBuilder::Create(const IMessage& message)
+{
+    return std::make_unique<FrameBuilderImpl>(message);
+}
+FrameBuilderImpl::FrameBuilderImpl(const IMessage& message)
+    : _message(&message)
+    , _frame(std::max<uint64_t>(message.MessageSize(), 8), 0)
+    , _pending(message.Signals_Size(), 0)
+    , _is_dirty(message.Signals_Size(), false)
+{
+    if (message.Encode(nullptr, 0, _frame.data(), _frame.size()) != IMessage::EEncodeError::NoError)
+    {
+        std::fill(_frame.begin(), _frame.end(), 0);
+    }
+    for (const ISignal& sig : message.Signals())
+    {
+        _encodable.push_back(sig.Error(ISignal::EErrorCode::NoError));
+        // the bytes of a signal are contiguous, big endian signals start with their most significant bit
+        uint64_t first_byte = sig.StartBit() / 8;
+        uint64_t n_bytes = sig.ByteOrder() == ISignal::EByteOrder::LittleEndian
+            ? (sig.StartBit() % 8 + sig.BitSize() + 7) / 8
+            : (sig.BitSize() + (7 - sig.StartBit() % 8) + 7) / 8;
+        uint64_t mask = 0;
+        for (uint64_t word = first_byte / 8; word <= (first_byte + n_bytes - 1) / 8 && word < 64; word++)
+        {
+            mask |= 1ull << word;
+        }
+        _word_masks.push_back(mask);
+    }
+}
+const IMessage& FrameBuilderImpl::Message() const
+{
+    return *_message;
+}
+IMessage::EEncodeError FrameBuilderImpl::Set(std::size_t signal, ISignal::raw_t raw)
+{
+    if (signal >= _encodable.size() || !_encodable[signal])
+    {
+        return IMessage::EEncodeError::InvalidSignal;
+    }
+    _pending[signal] = raw;
+    if (!_is_dirty[signal])
+    {
+        _is_dirty[signal] = true;
+        _dirty.push_back(uint32_t(signal));
+    }
+    return IMessage::EEncodeError::NoError;
+}
+uint64_t FrameBuilderImpl::Flush()
+{
+    uint64_t touched = 0;
+    for (auto i : _dirty)
+    {
+        _message->Signals_Get(i).Encode(_pending[i], _frame.data());
+        touched |= _word_masks[i];
+        _is_dirty[i] = false;
+    }
+    _dirty.clear();
+    return touched;
+}
+const uint8_t* FrameBuilderImpl::Data() const
+{
+    return _frame.data();
+}
+std::size_t FrameBuilderImpl::Size() const
+{
+    return _frame.size();
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include "dbcppp/FrameBuilder.h"
+
+namespace dbcppp
+{
+    class FrameBuilderImpl final
+        : public IFrameBuilder
+    {
+    public:
+        FrameBuilderImpl(const IMessage& message);
+
+        virtual const IMessage& Message() const override;
+
+        virtual IMessage::EEncodeError Set(std::size_t signal, ISignal::raw_t raw) override;
+        virtual uint64_t Flush() override;
+
+        virtual const uint8_t* Data() const override;
+        virtual std::size_t Size() const override;
+
+    private:
+        const IMessage* _message;
+        std::vector<uint8_t> _frame;
+        // last value set per signal, only meaningful for dirty signals
+        std::vector<ISignal::raw_t> _pending;
+        std::vector<uint32_t> _dirty;
+        std::vector<bool> _is_dirty;
+        // per signal the 64 bit words its bytes lie in
+        std::vector<uint64_t> _word_masks;
+        std::vector<bool> _encodable;
+    };
+}
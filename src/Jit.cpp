@@ -0,0 +1,288 @@
+#include <cstring>
+#include "Jit.h"
+
+#if defined(ENABLE_JIT) && (defined(__x86_64__) || defined(_M_X64))
+#   define DBCPPP_JIT_X64
+#   ifdef _WIN32
+#       include <windows.h>
+#   else
+#       include <sys/mman.h>
+#   endif
+#endif
+
+using namespace dbcppp;
+
+std::shared_ptr<const JitCode> JitCode::Create(const std::vector<uint8_t>& code)
+{
+#ifdef DBCPPP_JIT_X64
+    // the memory is never writable and executable at the same time
+#   ifdef _WIN32
+    void* memory = VirtualAlloc(nullptr, code.size(), MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    if (memory == nullptr)
+    {
+        return nullptr;
+    }
+    std::memcpy(memory, code.data(), code.size());
+    DWORD old_protect;
+    if (!VirtualProtect(memory, code.size(), PAGE_EXECUTE_READ, &old_protect))
+    {
+        VirtualFree(memory, 0, MEM_RELEASE);
+        return nullptr;
+    }
+    FlushInstructionCache(GetCurrentProcess(), memory, code.size());
+#   else
+    void* memory = mmap(nullptr, code.size(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED)
+    {
+        return nullptr;
+    }
+    std::memcpy(memory, code.data(), code.size());
+    if (mprotect(memory, code.size(), PROT_READ | PROT_EXEC) != 0)
+    {
+        munmap(memory, code.size());
+        return nullptr;
+    }
+#   endif
+    return std::make_shared<JitCode>(memory, code.size());
+#else
+    (void)code;
+    return nullptr;
+#endif
+}
+JitCode::JitCode(void* memory, std::size_t size)
+    : _memory(memory)
+    , _size(size)
+{}
+JitCode::~JitCode()
+{
+#ifdef DBCPPP_JIT_X64
+#   ifdef _WIN32
+    VirtualFree(_memory, 0, MEM_RELEASE);
+#   else
+    munmap(_memory, _size);
+#   endif
+#endif
+}
+const uint8_t* JitCode::Code() const
+{
+    return reinterpret_cast<const uint8_t*>(_memory);
+}
+
+#ifdef DBCPPP_JIT_X64
+namespace
+{
+    enum Reg : uint8_t
+    {
+        rax = 0, rcx = 1, rdx = 2, rbx = 3, rsp = 4, rbp = 5, rsi = 6, rdi = 7,
+        r8 = 8, r9 = 9, r10 = 10, r11 = 11
+    };
+    // DecodeSignals(const IMessage* msg, const void* bytes, raw_t* values), msg is not used.
+    // Only volatile registers are used and the stack isn't touched, so the generated
+    // functions are leaf functions which need neither prologue nor unwind info
+#   ifdef _WIN32
+    constexpr Reg reg_bytes = rdx;
+    constexpr Reg reg_values = r8;
+#   else
+    constexpr Reg reg_bytes = rsi;
+    constexpr Reg reg_values = rdx;
+#   endif
+    constexpr Reg reg_word = rax;
+    constexpr Reg reg_value = r10;
+    constexpr Reg reg_tmp = r11;
+
+    // minimal x86-64 encoder for the handful of instructions the decode routines need
+    class X64Emitter
+    {
+    public:
+        X64Emitter(std::vector<uint8_t>& code)
+            : _code(code)
+        {}
+        // mov dst, qword ptr [base + disp]
+        void load64(Reg dst, Reg base, uint32_t disp)
+        {
+            rex_w(dst, base);
+            _code.push_back(0x8B);
+            modrm_disp32(dst, base, disp);
+        }
+        // movzx dst, byte ptr [base + disp]
+        void load8(Reg dst, Reg base, uint32_t disp)
+        {
+            rex_w(dst, base);
+            _code.push_back(0x0F);
+            _code.push_back(0xB6);
+            modrm_disp32(dst, base, disp);
+        }
+        // mov qword ptr [base + disp], src
+        void store64(Reg base, uint32_t disp, Reg src)
+        {
+            rex_w(src, base);
+            _code.push_back(0x89);
+            modrm_disp32(src, base, disp);
+        }
+        void mov(Reg dst, Reg src)
+        {
+            rex_w(src, dst);
+            _code.push_back(0x89);
+            modrm_reg(src, dst);
+        }
+        void or_(Reg dst, Reg src)
+        {
+            rex_w(src, dst);
+            _code.push_back(0x09);
+            modrm_reg(src, dst);
+        }
+        void bswap(Reg r)
+        {
+            rex_w(rax, r);
+            _code.push_back(0x0F);
+            _code.push_back(uint8_t(0xC8 + (r & 7)));
+        }
+        void shl(Reg r, uint64_t n) { shift(4, r, n); }
+        void shr(Reg r, uint64_t n) { shift(5, r, n); }
+        void sar(Reg r, uint64_t n) { shift(7, r, n); }
+        void ret()
+        {
+            _code.push_back(0xC3);
+        }
+        void align(std::size_t alignment)
+        {
+            while (_code.size() % alignment)
+            {
+                _code.push_back(0xCC);
+            }
+        }
+
+    private:
+        void rex_w(Reg reg, Reg rm)
+        {
+            _code.push_back(uint8_t(0x48 | ((reg >> 3) << 2) | (rm >> 3)));
+        }
+        void modrm_reg(Reg reg, Reg rm)
+        {
+            _code.push_back(uint8_t(0xC0 | ((reg & 7) << 3) | (rm & 7)));
+        }
+        // base must not be rsp/r12, they would need a SIB byte
+        void modrm_disp32(Reg reg, Reg base, uint32_t disp)
+        {
+            _code.push_back(uint8_t(0x80 | ((reg & 7) << 3) | (base & 7)));
+            for (std::size_t i = 0; i < 4; i++)
+            {
+                _code.push_back(uint8_t(disp >> (8 * i)));
+            }
+        }
+        // shl/shr/sar r, imm8
+        void shift(uint8_t ext, Reg r, uint64_t n)
+        {
+            if (n == 0)
+            {
+                return;
+            }
+            rex_w(rax, r);
+            _code.push_back(0xC1);
+            _code.push_back(uint8_t(0xC0 | (ext << 3) | (r & 7)));
+            _code.push_back(uint8_t(n));
+        }
+
+        std::vector<uint8_t>& _code;
+    };
+
+    bool jit_supported(const MessageImpl& msg)
+    {
+        // signals which have to be decoded with the portable kernels aren't supported
+        return msg.decodeProgram().fallbacks().empty();
+    }
+    // emits the message's DecodeProgram with all shifts and masks as immediates
+    void emit_decode_signals(X64Emitter& e, const MessageImpl& msg)
+    {
+        const auto& fields = msg.decodeProgram().fields();
+        auto emit_field =
+            [&](const DecodeProgram::Field& f)
+            {
+                e.shl(reg_value, f.shift_left);
+                // the mask is only needed for unsigned values, for them the logical shift already masks
+                if (f.mask == ~0ull)
+                {
+                    e.sar(reg_value, f.shift_right);
+                }
+                else
+                {
+                    e.shr(reg_value, f.shift_right);
+                }
+                e.store64(reg_values, uint32_t(f.index * sizeof(ISignal::raw_t)), reg_value);
+            };
+        for (const auto& word : msg.decodeProgram().words())
+        {
+            e.load64(reg_word, reg_bytes, uint32_t(word.byte_pos));
+            if (word.byte_order == ISignal::EByteOrder::BigEndian)
+            {
+                e.bswap(reg_word);
+            }
+            for (uint32_t i = word.begin; i < word.end_fits; i++)
+            {
+                e.mov(reg_value, reg_word);
+                emit_field(fields[i]);
+            }
+            for (uint32_t i = word.end_fits; i < word.end; i++)
+            {
+                const auto& f = fields[i];
+                // combine the word with the 9th byte
+                e.mov(reg_value, reg_word);
+                e.load8(reg_tmp, reg_bytes, uint32_t(word.byte_pos + 8));
+                if (word.byte_order == ISignal::EByteOrder::BigEndian)
+                {
+                    e.shl(reg_value, f.shift_word);
+                    e.shr(reg_tmp, f.shift_byte);
+                }
+                else
+                {
+                    e.shr(reg_value, f.shift_word);
+                    e.shl(reg_tmp, f.shift_byte);
+                }
+                e.or_(reg_value, reg_tmp);
+                emit_field(f);
+            }
+        }
+        e.ret();
+    }
+}
+#endif
+
+bool dbcppp::jit_compile_messages(std::vector<MessageImpl>& messages)
+{
+#ifdef DBCPPP_JIT_X64
+    constexpr std::size_t not_compiled = std::size_t(-1);
+    std::vector<uint8_t> code;
+    X64Emitter e(code);
+    std::vector<std::size_t> offsets(messages.size(), not_compiled);
+    for (std::size_t i = 0; i < messages.size(); i++)
+    {
+        if (jit_supported(messages[i]))
+        {
+            e.align(16);
+            offsets[i] = code.size();
+            emit_decode_signals(e, messages[i]);
+        }
+    }
+    if (code.empty())
+    {
+        return true;
+    }
+    auto jit_code = JitCode::Create(code);
+    if (!jit_code)
+    {
+        return false;
+    }
+    for (std::size_t i = 0; i < messages.size(); i++)
+    {
+        if (offsets[i] != not_compiled)
+        {
+            auto address = reinterpret_cast<uintptr_t>(jit_code->Code() + offsets[i]);
+            messages[i].setDecodeSignals(reinterpret_cast<MessageImpl::decode_signals_func_t>(address), jit_code);
+        }
+    }
+    return true;
+#else
+    (void)messages;
+    return false;
+#endif
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include "MessageImpl.h"
+
+namespace dbcppp
+{
+    // block of executable memory
+    class JitCode
+    {
+    public:
+        // returns nullptr if the memory couldn't be allocated
+        static std::shared_ptr<const JitCode> Create(const std::vector<uint8_t>& code);
+
+        JitCode(void* memory, std::size_t size);
+        JitCode(const JitCode&) = delete;
+        JitCode& operator=(const JitCode&) = delete;
+        ~JitCode();
+
+        const uint8_t* Code() const;
+
+    private:
+        void* _memory;
+        std::size_t _size;
+    };
+
+    // compiles IMessage::DecodeSignals of all messages into one JitCode,
+    // returns false if the JIT isn't available on this platform
+    bool jit_compile_messages(std::vector<MessageImpl>& messages);
+}
@@ -1,8 +1,56 @@
 #include <algorithm>
+#include <cstring>
 #include "MessageImpl.h"
 
 using namespace dbcppp;
 
+ISignal::raw_t start_value(const SignalImpl& sig)
+{
+    // GenSigStartValue is a raw value, for float signals the raw value is the float itself
+    for (const IAttribute& attr : sig.AttributeValues())
+    {
+        if (attr.Name() != "GenSigStartValue")
+        {
+            continue;
+        }
+        double value = 0.;
+        if (auto i = std::get_if<int64_t>(&attr.Value()))
+        {
+            value = double(*i);
+            if (sig.ExtendedValueType() == ISignal::EExtendedValueType::Integer)
+            {
+                return ISignal::raw_t(*i);
+            }
+        }
+        else if (auto d = std::get_if<double>(&attr.Value()))
+        {
+            value = *d;
+        }
+        ISignal::raw_t raw = 0;
+        switch (sig.ExtendedValueType())
+        {
+        case ISignal::EExtendedValueType::Integer:
+            raw = ISignal::raw_t(int64_t(value));
+            break;
+        case ISignal::EExtendedValueType::Float:
+        {
+            float f = float(value);
+            std::memcpy(&raw, &f, sizeof(f));
+            break;
+        }
+        case ISignal::EExtendedValueType::Double:
+            std::memcpy(&raw, &value, sizeof(value));
+            break;
+        }
+        return raw;
+    }
+    return 0;
+}
+void decode_signals(const IMessage* msg, const void* bytes, ISignal::raw_t* values) noexcept
+{
+    const MessageImpl* msgi = static_cast<const MessageImpl*>(msg);
+    msgi->decodeProgram().execute(msgi->SignalDescriptors(), bytes, values);
+}
 
 std::unique_ptr<IMessage> IMessage::Create(
       uint64_t id
@@ -65,11 +113,17 @@ MessageImpl::MessageImpl(
     , _comment(std::move(comment))
     , _signal_groups(std::move(signal_groups))
     , _mux_signal(nullptr)
+    , _mux_dispatch(_signals)
+    , _mux_resolver(_signals)
+    , _change_masks(_signals)
+    , _decode_program(_signals)
     , _error(EErrorCode::NoError)
 {
+    _decode_signals = ::decode_signals;
     bool have_mux_value = false;
     for (const auto& sig : _signals)
     {
+        _descriptors.push_back(sig.descriptor());
         switch (sig.MultiplexerIndicator())
         {
         case ISignal::EMultiplexer::MuxValue:
@@ -84,6 +138,51 @@ MessageImpl::MessageImpl(
     {
         _error = EErrorCode::MuxValeWithoutMuxSignal;
     }
+    const std::size_t frame_size = std::max<uint64_t>(_message_size, 8);
+    _templates.assign(frame_size * _mux_dispatch.lists(), 0);
+    for (std::size_t i = 0; i < _mux_dispatch.lists(); i++)
+    {
+        uint8_t* frame = &_templates[i * frame_size];
+        const uint32_t* begin;
+        const uint32_t* end;
+        _mux_dispatch.list(i, begin, end);
+        for (; begin != end; ++begin)
+        {
+            const SignalImpl& sig = _signals[*begin];
+            // broken signals might write outside of the frame
+            if (sig.Error(ISignal::EErrorCode::NoError))
+            {
+                sig.Encode(start_value(sig), frame);
+            }
+        }
+        const uint32_t mux_switch = _mux_dispatch.switchIndex();
+        if (i != 0 && _signals[mux_switch].Error(ISignal::EErrorCode::NoError))
+        {
+            _signals[mux_switch].Encode(_mux_dispatch.listValue(i), frame);
+        }
+    }
+    for (const auto& group : _signal_groups)
+    {
+        SignalGroupProgram program;
+        program.resolved = true;
+        program.encodable = true;
+        for (const auto& name : group.SignalNames())
+        {
+            auto iter = std::find_if(_signals.begin(), _signals.end(),
+                [&](const SignalImpl& sig) { return sig.Name() == name; });
+            if (iter == _signals.end())
+            {
+                program.signals.push_back(uint32_t(-1));
+                program.resolved = false;
+                program.encodable = false;
+                continue;
+            }
+            program.signals.push_back(uint32_t(iter - _signals.begin()));
+            program.encodable &= iter->Error(ISignal::EErrorCode::NoError);
+        }
+        program.program = DecodeProgram(_signals, program.signals);
+        _signal_group_programs.push_back(std::move(program));
+    }
 }
 MessageImpl::MessageImpl(const MessageImpl& other)
 {
@@ -95,6 +194,7 @@ MessageImpl::MessageImpl(const MessageImpl& other)
     _signals = other._signals;
     _attribute_values = other._attribute_values;
     _comment = other._comment;
+    _signal_groups = other._signal_groups;
     _mux_signal = nullptr;
     for (const auto& sig : _signals)
     {
@@ -106,6 +206,15 @@ MessageImpl::MessageImpl(const MessageImpl& other)
         }
     }
     _error = other._error;
+    _descriptors = other._descriptors;
+    _mux_dispatch = other._mux_dispatch;
+    _mux_resolver = other._mux_resolver;
+    _templates = other._templates;
+    _change_masks = other._change_masks;
+    _decode_program = other._decode_program;
+    _signal_group_programs = other._signal_group_programs;
+    _decode_signals = other._decode_signals;
+    _jit_code = other._jit_code;
 }
 MessageImpl& MessageImpl::operator=(const MessageImpl& other)
 {
@@ -117,6 +226,7 @@ MessageImpl& MessageImpl::operator=(const MessageImpl& other)
     _signals = other._signals;
     _attribute_values = other._attribute_values;
     _comment = other._comment;
+    _signal_groups = other._signal_groups;
     _mux_signal = nullptr;
     for (const auto& sig : _signals)
     {
@@ -128,6 +238,15 @@ MessageImpl& MessageImpl::operator=(const MessageImpl& other)
         }
     }
     _error = other._error;
+    _descriptors = other._descriptors;
+    _mux_dispatch = other._mux_dispatch;
+    _mux_resolver = other._mux_resolver;
+    _templates = other._templates;
+    _change_masks = other._change_masks;
+    _decode_program = other._decode_program;
+    _signal_group_programs = other._signal_group_programs;
+    _decode_signals = other._decode_signals;
+    _jit_code = other._jit_code;
     return *this;
 }
 std::unique_ptr<IMessage> MessageImpl::Clone() const
@@ -194,11 +313,330 @@ MessageImpl::EErrorCode MessageImpl::Error() const
 {
     return _error;
 }
+const ISignal::Descriptor* MessageImpl::SignalDescriptors() const
+{
+    return _descriptors.data();
+}
+template <bool aSized, class Filter>
+void MessageImpl::decode(const void* bytes, std::size_t size, DecodeResult& result, Filter&& filter) const
+{
+    auto decode_signal =
+        [&](uint32_t i)
+        {
+            if constexpr (aSized)
+            {
+                return _descriptors[i].Decode(bytes, size);
+            }
+            else
+            {
+                return _descriptors[i].Decode(bytes);
+            }
+        };
+    result.Clear();
+    if (_mux_dispatch.extended())
+    {
+        MuxResolver::State state(_mux_resolver);
+        if constexpr (aSized)
+        {
+            _mux_resolver.evaluate(_descriptors.data(), bytes, size, state);
+        }
+        else
+        {
+            _mux_resolver.evaluate(_descriptors.data(), bytes, state);
+        }
+        for (uint32_t i = 0; i < _signals.size(); i++)
+        {
+            if (_mux_resolver.active(state, i) && filter(i))
+            {
+                result.Push(i, decode_signal(i));
+            }
+        }
+        return;
+    }
+    const uint32_t* begin;
+    const uint32_t* end;
+    if constexpr (aSized)
+    {
+        _mux_dispatch.lookup(_descriptors.data(), bytes, size, begin, end);
+    }
+    else
+    {
+        _mux_dispatch.lookup(_descriptors.data(), bytes, begin, end);
+    }
+    for (; begin != end; ++begin)
+    {
+        if (filter(*begin))
+        {
+            result.Push(*begin, decode_signal(*begin));
+        }
+    }
+}
+void MessageImpl::Decode(const void* bytes, DecodeResult& result) const
+{
+    decode<false>(bytes, 0, result, [](uint32_t) { return true; });
+}
+void MessageImpl::Decode(const void* bytes, std::size_t size, DecodeResult& result) const
+{
+    decode<true>(bytes, size, result, [](uint32_t) { return true; });
+}
+void MessageImpl::DecodeChanges(const void* bytes, ChangeState& state, DecodeResult& result) const
+{
+    constexpr std::size_t n_words = ChangeState::MaxFrameSize / 8;
+    uint64_t frame[n_words] = {};
+    std::memcpy(frame, bytes, std::min<uint64_t>(std::max<uint64_t>(_message_size, 8), ChangeState::MaxFrameSize));
+    uint64_t diff[n_words];
+    uint64_t any = 0;
+    for (std::size_t i = 0; i < n_words; i++)
+    {
+        diff[i] = state._valid ? frame[i] ^ state._previous[i] : ~0ull;
+        any |= diff[i];
+    }
+    std::memcpy(state._previous, frame, sizeof(frame));
+    state._valid = true;
+    if (any == 0 && _change_masks.complete())
+    {
+        // the usual case for periodic frames, nothing has to be decoded
+        result.Clear();
+        return;
+    }
+    decode<false>(bytes, 0, result, [&](uint32_t i) { return _change_masks.changed(i, diff); });
+}
+MessageImpl::EEncodeError MessageImpl::Encode(const DecodeResult::Entry* values, std::size_t n, void* buffer, std::size_t size) const
+{
+    const std::size_t frame_size = std::max<uint64_t>(_message_size, 8);
+    if (size < frame_size)
+    {
+        return EEncodeError::BufferTooSmall;
+    }
+    for (std::size_t i = 0; i < n; i++)
+    {
+        if (values[i].signal >= _signals.size() || !_signals[values[i].signal].Error(ISignal::EErrorCode::NoError))
+        {
+            return EEncodeError::InvalidSignal;
+        }
+    }
+    std::size_t list = 0;
+    const uint32_t mux_switch = _mux_dispatch.switchIndex();
+    const bool simple_mux = !_mux_dispatch.extended() && mux_switch != uint32_t(-1) &&
+        _signals[mux_switch].Error(ISignal::EErrorCode::NoError);
+    if (simple_mux)
+    {
+        // the switch value as it ends up in the frame, the default template holds the start value of the switch
+        std::memcpy(buffer, &_templates[0], frame_size);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            if (values[i].signal == mux_switch)
+            {
+                _signals[mux_switch].Encode(values[i].raw, buffer);
+            }
+        }
+        const ISignal::raw_t switch_value = _descriptors[mux_switch].Decode(buffer);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            const SignalImpl& sig = _signals[values[i].signal];
+            if (sig.MultiplexerIndicator() == ISignal::EMultiplexer::MuxValue && sig.MultiplexerSwitchValue() != switch_value)
+            {
+                return EEncodeError::SignalNotPresent;
+            }
+        }
+        list = _mux_dispatch.find(switch_value);
+    }
+    else if (!_mux_dispatch.extended())
+    {
+        for (std::size_t i = 0; i < n; i++)
+        {
+            if (_signals[values[i].signal].MultiplexerIndicator() == ISignal::EMultiplexer::MuxValue)
+            {
+                return EEncodeError::SignalNotPresent;
+            }
+        }
+    }
+    std::memcpy(buffer, &_templates[list * frame_size], frame_size);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        _signals[values[i].signal].Encode(values[i].raw, buffer);
+    }
+    if (_mux_dispatch.extended())
+    {
+        // the switches are known only after all values are merged in
+        MuxResolver::State state(_mux_resolver);
+        _mux_resolver.evaluate(_descriptors.data(), buffer, state);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            if (!_mux_resolver.active(state, values[i].signal))
+            {
+                return EEncodeError::SignalNotPresent;
+            }
+        }
+    }
+    return EEncodeError::NoError;
+}
+void MessageImpl::DecodeSignalGroup(std::size_t group, const void* bytes, ISignal::raw_t* values) const
+{
+    const SignalGroupProgram& program = _signal_group_programs[group];
+    program.program.execute(_descriptors.data(), bytes, values);
+    if (!program.resolved)
+    {
+        for (std::size_t i = 0; i < program.signals.size(); i++)
+        {
+            if (program.signals[i] == uint32_t(-1))
+            {
+                values[i] = 0;
+            }
+        }
+    }
+}
+MessageImpl::EEncodeError MessageImpl::EncodeSignalGroup(std::size_t group, const ISignal::raw_t* values, void* buffer, std::size_t size) const
+{
+    if (size < std::max<uint64_t>(_message_size, 8))
+    {
+        return EEncodeError::BufferTooSmall;
+    }
+    const SignalGroupProgram& program = _signal_group_programs[group];
+    if (!program.encodable)
+    {
+        return EEncodeError::InvalidSignal;
+    }
+    for (std::size_t i = 0; i < program.signals.size(); i++)
+    {
+        _signals[program.signals[i]].Encode(values[i], buffer);
+    }
+    return EEncodeError::NoError;
+}
+void MessageImpl::DecodeColumns(const void* frames, std::size_t frame_stride, std::size_t count,
+    const Column* columns, std::size_t n_columns) const
+{
+    // frames are processed in chunks so the intermediate buffers stay in the L1 cache,
+    // the chunk size is a multiple of 8 so each chunk starts at a byte of the validity bitmaps
+    constexpr std::size_t chunk_size = 256;
+    ISignal::raw_t raw[chunk_size];
+    ISignal::raw_t mux[chunk_size];
+    double phys[chunk_size];
+    const uint8_t* f = reinterpret_cast<const uint8_t*>(frames);
+    for (std::size_t begin = 0; begin < count; begin += chunk_size)
+    {
+        const std::size_t n = std::min(chunk_size, count - begin);
+        const uint8_t* chunk = f + begin * frame_stride;
+        bool mux_decoded = false;
+        bool extended = false;
+        for (std::size_t c = 0; c < n_columns; c++)
+        {
+            const Column& col = columns[c];
+            const SignalImpl& sig = _signals[col.signal];
+            const std::size_t value_size = col.physical ? sizeof(double) : sizeof(ISignal::raw_t);
+            const std::size_t stride = col.stride ? col.stride : value_size;
+            uint8_t* out = reinterpret_cast<uint8_t*>(col.values) + begin * stride;
+            const void* result;
+            // tightly packed columns are written by the batch kernels directly
+            if (!col.physical)
+            {
+                ISignal::raw_t* dst = stride == value_size ? reinterpret_cast<ISignal::raw_t*>(out) : raw;
+                sig.DecodeBatch(chunk, frame_stride, n, dst);
+                result = dst;
+            }
+            else
+            {
+                double* dst = stride == value_size ? reinterpret_cast<double*>(out) : phys;
+                sig.DecodeBatch(chunk, frame_stride, n, raw);
+                sig.RawToPhysBatch(raw, dst, n);
+                result = dst;
+            }
+            if (stride != value_size)
+            {
+                const uint8_t* src = reinterpret_cast<const uint8_t*>(result);
+                for (std::size_t i = 0; i < n; i++)
+                {
+                    std::memcpy(out + i * stride, src + i * value_size, value_size);
+                }
+            }
+            if (!col.validity)
+            {
+                continue;
+            }
+            uint8_t* bitmap = col.validity + begin / 8;
+            if (sig.MultiplexerIndicator() != ISignal::EMultiplexer::MuxValue)
+            {
+                for (std::size_t i = 0; i < n; i += 8)
+                {
+                    bitmap[i / 8] = n - i >= 8 ? 0xFF : uint8_t((1u << (n - i)) - 1);
+                }
+            }
+            else if (sig.SignalMultiplexerValues_Size() == 0 && _mux_signal)
+            {
+                if (!mux_decoded)
+                {
+                    _mux_signal->DecodeBatch(chunk, frame_stride, n, mux);
+                    mux_decoded = true;
+                }
+                const ISignal::raw_t switch_value = sig.MultiplexerSwitchValue();
+                for (std::size_t i = 0; i < n; i += 8)
+                {
+                    uint8_t byte = 0;
+                    for (std::size_t j = 0; j < 8 && i + j < n; j++)
+                    {
+                        byte |= uint8_t(mux[i + j] == switch_value) << j;
+                    }
+                    bitmap[i / 8] = byte;
+                }
+            }
+            else
+            {
+                // set below, once the switches of all frames are decoded
+                std::memset(bitmap, 0, (n + 7) / 8);
+                extended = true;
+            }
+        }
+        if (!extended)
+        {
+            continue;
+        }
+        // extended multiplexing: the switches are decoded once per frame for all columns
+        MuxResolver::State state(_mux_resolver);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            _mux_resolver.evaluate(_descriptors.data(), chunk + i * frame_stride, state);
+            for (std::size_t c = 0; c < n_columns; c++)
+            {
+                const Column& col = columns[c];
+                const SignalImpl& sig = _signals[col.signal];
+                if (col.validity && sig.MultiplexerIndicator() == ISignal::EMultiplexer::MuxValue &&
+                    (sig.SignalMultiplexerValues_Size() != 0 || !_mux_signal))
+                {
+                    col.validity[(begin + i) / 8] |= uint8_t(_mux_resolver.active(state, col.signal)) << (i % 8);
+                }
+            }
+        }
+    }
+}
 
 const std::vector<SignalImpl>& MessageImpl::signals() const
 {
     return _signals;
 }
+const DecodeProgram& MessageImpl::decodeProgram() const
+{
+    return _decode_program;
+}
+const MuxDispatch& MessageImpl::muxDispatch() const
+{
+    return _mux_dispatch;
+}
+const MuxResolver& MessageImpl::muxResolver() const
+{
+    return _mux_resolver;
+}
+void MessageImpl::setDecodeSignals(decode_signals_func_t decode_signals, std::shared_ptr<const JitCode> code)
+{
+    _decode_signals = decode_signals;
+    _jit_code = std::move(code);
+}
+void MessageImpl::setMessageIndex(uint32_t index)
+{
+    for (auto& sig : _signals)
+    {
+        sig._message_index = index;
+    }
+}
 bool MessageImpl::operator==(const IMessage& rhs) const
 {
     bool equal = true;
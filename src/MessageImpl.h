@@ -1,13 +1,20 @@
 #pragma once
 
+#include <memory>
+
 #include "dbcppp/Message.h"
 #include "SignalImpl.h"
 #include "NodeImpl.h"
 #include "AttributeImpl.h"
 #include "SignalGroupImpl.h"
+#include "DecodeProgram.h"
+#include "MuxDispatch.h"
+#include "MuxResolver.h"
+#include "ChangeMasks.h"
 
 namespace dbcppp
 {
+    class JitCode;
     class MessageImpl final
         : public IMessage
     {
@@ -45,13 +52,48 @@ namespace dbcppp
         virtual const ISignal* MuxSignal() const override;
         
         virtual EErrorCode Error() const override;
+
+        virtual const ISignal::Descriptor* SignalDescriptors() const override;
+
+        virtual void Decode(const void* bytes, DecodeResult& result) const override;
+        virtual void Decode(const void* bytes, std::size_t size, DecodeResult& result) const override;
+        virtual void DecodeChanges(const void* bytes, ChangeState& state, DecodeResult& result) const override;
+        virtual EEncodeError Encode(const DecodeResult::Entry* values, std::size_t n, void* buffer, std::size_t size) const override;
+        virtual void DecodeSignalGroup(std::size_t group, const void* bytes, ISignal::raw_t* values) const override;
+        virtual EEncodeError EncodeSignalGroup(std::size_t group, const ISignal::raw_t* values, void* buffer, std::size_t size) const override;
+        virtual void DecodeColumns(const void* frames, std::size_t frame_stride, std::size_t count,
+            const Column* columns, std::size_t n_columns) const override;
         
         const std::vector<SignalImpl>& signals() const;
+        const DecodeProgram& decodeProgram() const;
+        const MuxDispatch& muxDispatch() const;
+        const MuxResolver& muxResolver() const;
+
+        using decode_signals_func_t = void (*)(const IMessage* msg, const void* bytes, ISignal::raw_t* values) noexcept;
+        // replaces DecodeSignals with generated code, code keeps the memory decode_signals lives in alive
+        void setDecodeSignals(decode_signals_func_t decode_signals, std::shared_ptr<const JitCode> code);
+        // stores the index of the message in its network in the signals
+        void setMessageIndex(uint32_t index);
         
         virtual bool operator==(const IMessage& rhs) const override;
         virtual bool operator!=(const IMessage& rhs) const override;
         
     private:
+        struct SignalGroupProgram
+        {
+            // indices of the group's signals, uint32_t(-1) for names which couldn't be resolved
+            std::vector<uint32_t> signals;
+            // decodes the resolved signals into their position in the record
+            DecodeProgram program;
+            bool resolved;
+            bool encodable;
+        };
+
+        // pushes the present signals for which filter(index) returns true,
+        // size is only used (and bytes may be shorter than ISignal::Decode requires) if aSized is true
+        template <bool aSized, class Filter>
+        void decode(const void* bytes, std::size_t size, DecodeResult& result, Filter&& filter) const;
+
         uint64_t _id;
         std::string _name;
         uint64_t _message_size;
@@ -63,6 +105,16 @@ namespace dbcppp
         std::vector<SignalGroupImpl> _signal_groups;
 
         const ISignal* _mux_signal;
+        std::vector<ISignal::Descriptor> _descriptors;
+        MuxDispatch _mux_dispatch;
+        MuxResolver _mux_resolver;
+        // one template frame of max(8, message size) bytes per signal list of _mux_dispatch
+        std::vector<uint8_t> _templates;
+        ChangeMasks _change_masks;
+        DecodeProgram _decode_program;
+        // one per signal group
+        std::vector<SignalGroupProgram> _signal_group_programs;
+        std::shared_ptr<const JitCode> _jit_code;
 
         EErrorCode _error;
     };
@@ -0,0 +1,86 @@
+#include "MessageIndex.h"
+
+using namespace dbcppp;
+
+namespace
+{
+    uint64_t hash_id(uint64_t id)
+    {
+        id *= 0x9E3779B97F4A7C15ull;
+        return id ^ (id >> 32);
+    }
+}
+
+MessageIndex::MessageIndex(const std::vector<MessageImpl>& messages)
+    : _standard(standard_ids, none)
+{
+    std::size_t n_other = 0;
+    for (const auto& msg : messages)
+    {
+        n_other += msg.Id() != independent_signals_id && key(msg.Id()) >= standard_ids;
+    }
+    // keep the load factor at or below 0.5
+    std::size_t n_slots = 1;
+    while (n_slots < 2 * n_other)
+    {
+        n_slots *= 2;
+    }
+    _slots.assign(n_slots, {0, none});
+    _slot_mask = n_slots - 1;
+    for (uint32_t i = 0; i < messages.size(); i++)
+    {
+        if (messages[i].Id() == independent_signals_id)
+        {
+            continue;
+        }
+        uint64_t k = key(messages[i].Id());
+        if (k < standard_ids)
+        {
+            if (_standard[k] == none)
+            {
+                _standard[k] = i;
+            }
+            continue;
+        }
+        uint64_t pos = hash_id(k) & _slot_mask;
+        while (_slots[pos].index != none && _slots[pos].id != k)
+        {
+            pos = (pos + 1) & _slot_mask;
+        }
+        if (_slots[pos].index == none)
+        {
+            _slots[pos] = {k, i};
+        }
+    }
+}
+uint64_t MessageIndex::key(uint64_t id) noexcept
+{
+    // the RTR and error flags (bits 30 and 29) next to the extended flag don't belong to the id,
+    // a standard id with one of them set is a SocketCAN can_id of a standard frame
+    constexpr uint64_t flags = 0x60000000;
+    if (id & extended_flag)
+    {
+        return id & (extended_flag | 0x1FFFFFFF);
+    }
+    return id & flags ? id & 0x7FF : id;
+}
+uint32_t MessageIndex::find(uint64_t id) const noexcept
+{
+    uint64_t k = key(id);
+    if (k < standard_ids)
+    {
+        return _standard.empty() ? none : _standard[k];
+    }
+    if (_slots.empty())
+    {
+        return none;
+    }
+    for (uint64_t pos = hash_id(k) & _slot_mask; _slots[pos].index != none; pos = (pos + 1) & _slot_mask)
+    {
+        if (_slots[pos].id == k)
+        {
+            return _slots[pos].index;
+        }
+    }
+    return none;
+}
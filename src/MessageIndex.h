@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include "MessageImpl.h"
+
+namespace dbcppp
+{
+    // Maps message ids to the index of the message. Standard ids are looked up in a direct-mapped table,
+    // all other ids in an open addressing hash table with linear probing.
+    class MessageIndex
+    {
+    public:
+        static constexpr uint32_t none = uint32_t(-1);
+        // bit 31 of an id marks an extended (29 bit) id, like CAN_EFF_FLAG of SocketCAN
+        static constexpr uint64_t extended_flag = 0x80000000;
+        // id of the pseudo message VECTOR__INDEPENDENT_SIG_MSG which holds the signals not belonging to any
+        // message, it isn't a frame and isn't indexed
+        static constexpr uint64_t independent_signals_id = 0xC0000000;
+        static constexpr uint64_t standard_ids = 2048;
+
+        MessageIndex() = default;
+        MessageIndex(const std::vector<MessageImpl>& messages);
+
+        // index of the first message with the id, none if there is none
+        uint32_t find(uint64_t id) const noexcept;
+
+    private:
+        struct Slot
+        {
+            uint64_t id;
+            uint32_t index;
+        };
+
+        static uint64_t key(uint64_t id) noexcept;
+
+        std::vector<uint32_t> _standard;
+        std::vector<Slot> _slots;
+        uint64_t _slot_mask = 0;
+    };
+}
@@ -0,0 +1,115 @@
+#include <algorithm>
+#include "MuxDispatch.h"
+
+using namespace dbcppp;
+
+MuxDispatch::MuxDispatch(const std::vector<SignalImpl>& signals)
+{
+    std::vector<uint64_t> values;
+    for (uint32_t i = 0; i < signals.size(); i++)
+    {
+        const SignalImpl& sig = signals[i];
+        if (sig.SignalMultiplexerValues_Size())
+        {
+            _extended = true;
+        }
+        switch (sig.MultiplexerIndicator())
+        {
+        case ISignal::EMultiplexer::MuxSwitch:
+            // like MessageImpl::MuxSignal() the last switch wins
+            _switch = i;
+            break;
+        case ISignal::EMultiplexer::MuxValue:
+            values.push_back(sig.MultiplexerSwitchValue());
+            break;
+        default:
+            break;
+        }
+    }
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+    auto add_list =
+        [&](bool with_value, uint64_t value)
+        {
+            Case c{value, uint32_t(_indices.size()), 0};
+            for (uint32_t i = 0; i < signals.size(); i++)
+            {
+                const SignalImpl& sig = signals[i];
+                if (sig.MultiplexerIndicator() != ISignal::EMultiplexer::MuxValue ||
+                    (with_value && _switch != none && sig.MultiplexerSwitchValue() == value))
+                {
+                    _indices.push_back(i);
+                }
+            }
+            c.end = uint32_t(_indices.size());
+            return c;
+        };
+    _default = add_list(false, 0);
+    // without a switch no multiplexed signal is ever present
+    if (_switch == none)
+    {
+        return;
+    }
+    for (auto value : values)
+    {
+        _cases.push_back(add_list(true, value));
+    }
+    if (!_cases.empty() && _cases.back().value < 64 + 4 * _cases.size())
+    {
+        _dense.assign(std::size_t(_cases.back().value + 1), none);
+        for (uint32_t i = 0; i < _cases.size(); i++)
+        {
+            _dense[std::size_t(_cases[i].value)] = i;
+        }
+    }
+}
+void MuxDispatch::lookup(const ISignal::Descriptor* descriptors, const void* bytes, const uint32_t*& begin, const uint32_t*& end) const noexcept
+{
+    std::size_t i = _switch != none && !_cases.empty() ? find(descriptors[_switch].Decode(bytes)) : 0;
+    list(i, begin, end);
+}
+void MuxDispatch::lookup(const ISignal::Descriptor* descriptors, const void* bytes, std::size_t size, const uint32_t*& begin, const uint32_t*& end) const noexcept
+{
+    std::size_t i = _switch != none && !_cases.empty() ? find(descriptors[_switch].Decode(bytes, size)) : 0;
+    list(i, begin, end);
+}
+std::size_t MuxDispatch::find(uint64_t switch_value) const noexcept
+{
+    if (!_dense.empty())
+    {
+        if (switch_value < _dense.size() && _dense[std::size_t(switch_value)] != none)
+        {
+            return _dense[std::size_t(switch_value)] + 1;
+        }
+        return 0;
+    }
+    auto iter = std::lower_bound(_cases.begin(), _cases.end(), switch_value,
+        [](const Case& c, uint64_t v) { return c.value < v; });
+    if (iter != _cases.end() && iter->value == switch_value)
+    {
+        return std::size_t(iter - _cases.begin()) + 1;
+    }
+    return 0;
+}
+std::size_t MuxDispatch::lists() const noexcept
+{
+    return _cases.size() + 1;
+}
+void MuxDispatch::list(std::size_t i, const uint32_t*& begin, const uint32_t*& end) const noexcept
+{
+    const Case& c = i == 0 ? _default : _cases[i - 1];
+    begin = _indices.data() + c.begin;
+    end = _indices.data() + c.end;
+}
+uint64_t MuxDispatch::listValue(std::size_t i) const noexcept
+{
+    return _cases[i - 1].value;
+}
+uint32_t MuxDispatch::switchIndex() const noexcept
+{
+    return _switch;
+}
+bool MuxDispatch::extended() const noexcept
+{
+    return _extended;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include "SignalImpl.h"
+
+namespace dbcppp
+{
+    // Maps the value of a message's multiplexer switch to the indices of the signals which are
+    // present for that value, so a decode only has to look at the signals it returns.
+    class MuxDispatch
+    {
+    public:
+        MuxDispatch() = default;
+        MuxDispatch(const std::vector<SignalImpl>& signals);
+
+        // the signals present in the frame in ascending order, [begin, end) of one precomputed list
+        void lookup(const ISignal::Descriptor* descriptors, const void* bytes, const uint32_t*& begin, const uint32_t*& end) const noexcept;
+        // same as lookup, but the switch is decoded from a buffer of size bytes
+        void lookup(const ISignal::Descriptor* descriptors, const void* bytes, std::size_t size, const uint32_t*& begin, const uint32_t*& end) const noexcept;
+        // index of the signal list for the switch value, 0 is the list of the non multiplexed signals
+        // which is used for switch values no signal is multiplexed on
+        std::size_t find(uint64_t switch_value) const noexcept;
+        std::size_t lists() const noexcept;
+        void list(std::size_t i, const uint32_t*& begin, const uint32_t*& end) const noexcept;
+        // switch value of list i > 0
+        uint64_t listValue(std::size_t i) const noexcept;
+        // index of the multiplexer switch, uint32_t(-1) if the message has none
+        uint32_t switchIndex() const noexcept;
+        // the message uses extended multiplexing (SG_MUL_VAL_), which the table can't express
+        bool extended() const noexcept;
+
+    private:
+        static constexpr uint32_t none = uint32_t(-1);
+
+        struct Case
+        {
+            uint64_t value;
+            uint32_t begin;
+            uint32_t end;
+        };
+
+        bool _extended = false;
+        uint32_t _switch = none;
+        // concatenated lists of signal indices
+        std::vector<uint32_t> _indices;
+        // list for switch values no signal is multiplexed on (only the non multiplexed signals)
+        Case _default = {0, 0, 0};
+        // cases sorted by value, if the values are small _dense[value] is the index of the case or none
+        std::vector<Case> _cases;
+        std::vector<uint32_t> _dense;
+    };
+}
@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <unordered_map>
+#include "MuxResolver.h"
+
+using namespace dbcppp;
+
+MuxResolver::State::State(const MuxResolver& resolver)
+    : _values(_inline_values)
+    , _active(_inline_active)
+{
+    if (resolver._nodes.size() > inline_nodes)
+    {
+        _heap_values = std::make_unique<uint64_t[]>(resolver._nodes.size());
+        _heap_active = std::make_unique<bool[]>(resolver._nodes.size());
+        _values = _heap_values.get();
+        _active = _heap_active.get();
+    }
+}
+MuxResolver::MuxResolver(const std::vector<SignalImpl>& signals)
+{
+    struct RawCondition
+    {
+        uint32_t signal;
+        std::vector<Range> ranges;
+    };
+    std::unordered_map<std::string, uint32_t> names;
+    uint32_t mux_switch = none;
+    for (uint32_t i = 0; i < signals.size(); i++)
+    {
+        names.emplace(signals[i].Name(), i);
+        if (signals[i].MultiplexerIndicator() == ISignal::EMultiplexer::MuxSwitch)
+        {
+            // like MessageImpl::MuxSignal() the last switch wins
+            mux_switch = i;
+        }
+    }
+    std::vector<std::vector<RawCondition>> raw(signals.size());
+    std::vector<bool> never(signals.size(), false);
+    for (uint32_t i = 0; i < signals.size(); i++)
+    {
+        const SignalImpl& sig = signals[i];
+        if (sig.MultiplexerIndicator() != ISignal::EMultiplexer::MuxValue)
+        {
+            continue;
+        }
+        if (sig.SignalMultiplexerValues_Size() == 0)
+        {
+            if (mux_switch == none)
+            {
+                never[i] = true;
+            }
+            else
+            {
+                raw[i].push_back({mux_switch, {{sig.MultiplexerSwitchValue(), sig.MultiplexerSwitchValue()}}});
+            }
+            continue;
+        }
+        for (const auto& smv : sig.SignalMultiplexerValues())
+        {
+            auto iter = names.find(smv.SwitchName());
+            if (iter == names.end())
+            {
+                never[i] = true;
+                break;
+            }
+            RawCondition cond{iter->second, {}};
+            for (const auto& range : smv.ValueRanges())
+            {
+                cond.ranges.push_back({uint64_t(range.from), uint64_t(range.to)});
+            }
+            raw[i].push_back(std::move(cond));
+        }
+    }
+
+    // order the switches so that every switch comes after the switches it depends on
+    std::vector<uint32_t> node_of(signals.size(), none);
+    std::vector<uint8_t> visit(signals.size(), 0);
+    auto visit_switch =
+        [&](auto& self, uint32_t sig) -> void
+        {
+            visit[sig] = 1;
+            for (const auto& cond : raw[sig])
+            {
+                if (visit[cond.signal] == 1)
+                {
+                    // cycle, the switches in it can never be present
+                    never[sig] = true;
+                }
+                else if (visit[cond.signal] == 0)
+                {
+                    self(self, cond.signal);
+                }
+            }
+            visit[sig] = 2;
+            node_of[sig] = uint32_t(_nodes.size());
+            _nodes.push_back({sig});
+        };
+    for (uint32_t i = 0; i < signals.size(); i++)
+    {
+        for (const auto& cond : raw[i])
+        {
+            if (visit[cond.signal] == 0)
+            {
+                visit_switch(visit_switch, cond.signal);
+            }
+        }
+    }
+
+    _signal_conditions.resize(signals.size());
+    for (uint32_t i = 0; i < signals.size(); i++)
+    {
+        Conditions& conds = _signal_conditions[i];
+        conds.begin = uint32_t(_conditions.size());
+        conds.never = never[i];
+        if (!conds.never)
+        {
+            for (auto& cond : raw[i])
+            {
+                Condition c{};
+                c.node = node_of[cond.signal];
+                // merge overlapping ranges so a binary search finds the only candidate
+                std::sort(cond.ranges.begin(), cond.ranges.end(),
+                    [](const Range& lhs, const Range& rhs) { return lhs.from < rhs.from; });
+                c.ranges_begin = uint32_t(_ranges.size());
+                c.bitset_only = true;
+                for (const auto& range : cond.ranges)
+                {
+                    if (range.from > range.to)
+                    {
+                        continue;
+                    }
+                    if (_ranges.size() > c.ranges_begin && range.from <= _ranges.back().to + 1 && _ranges.back().to != ~0ull)
+                    {
+                        _ranges.back().to = std::max(_ranges.back().to, range.to);
+                    }
+                    else
+                    {
+                        _ranges.push_back(range);
+                    }
+                    for (uint64_t v = range.from; v <= std::min<uint64_t>(range.to, 255); v++)
+                    {
+                        c.bitset[v / 64] |= 1ull << (v % 64);
+                    }
+                    c.bitset_only &= range.to < 256;
+                }
+                c.ranges_end = uint32_t(_ranges.size());
+                _conditions.push_back(c);
+            }
+        }
+        conds.end = uint32_t(_conditions.size());
+    }
+}
+void MuxResolver::evaluate(const ISignal::Descriptor* descriptors, const void* bytes, State& state) const noexcept
+{
+    for (uint32_t i = 0; i < _nodes.size(); i++)
+    {
+        const uint32_t sig = _nodes[i].signal;
+        // the conditions of a switch only refer to switches evaluated before it
+        state._active[i] = check(state, _signal_conditions[sig]);
+        state._values[i] = descriptors[sig].Decode(bytes);
+    }
+}
+void MuxResolver::evaluate(const ISignal::Descriptor* descriptors, const void* bytes, std::size_t size, State& state) const noexcept
+{
+    for (uint32_t i = 0; i < _nodes.size(); i++)
+    {
+        const uint32_t sig = _nodes[i].signal;
+        state._active[i] = check(state, _signal_conditions[sig]);
+        state._values[i] = descriptors[sig].Decode(bytes, size);
+    }
+}
+bool MuxResolver::active(const State& state, std::size_t signal) const noexcept
+{
+    return check(state, _signal_conditions[signal]);
+}
+bool MuxResolver::check(const State& state, const Conditions& conditions) const noexcept
+{
+    if (conditions.never)
+    {
+        return false;
+    }
+    for (uint32_t i = conditions.begin; i < conditions.end; i++)
+    {
+        const Condition& c = _conditions[i];
+        if (!state._active[c.node])
+        {
+            return false;
+        }
+        const uint64_t value = state._values[c.node];
+        if (value < 256)
+        {
+            if (!((c.bitset[value / 64] >> (value % 64)) & 1))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            if (c.bitset_only)
+            {
+                return false;
+            }
+            auto begin = _ranges.begin() + c.ranges_begin;
+            auto end = _ranges.begin() + c.ranges_end;
+            auto iter = std::upper_bound(begin, end, value,
+                [](uint64_t v, const Range& r) { return v < r.from; });
+            if (iter == begin || (iter - 1)->to < value)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+#include "SignalImpl.h"
+
+namespace dbcppp
+{
+    // Decides which signals of a message are present in a frame, including extended
+    // multiplexing (SG_MUL_VAL_). The switch names are resolved to indices once and the switches
+    // are sorted so each one is decoded once per frame, after the switches it depends on.
+    class MuxResolver
+    {
+    public:
+        // decoded switches of one frame
+        class State
+        {
+        public:
+            State(const MuxResolver& resolver);
+
+        private:
+            friend class MuxResolver;
+
+            static constexpr std::size_t inline_nodes = 32;
+
+            uint64_t _inline_values[inline_nodes];
+            bool _inline_active[inline_nodes];
+            // only allocated for messages with more switches than fit inline
+            std::unique_ptr<uint64_t[]> _heap_values;
+            std::unique_ptr<bool[]> _heap_active;
+            uint64_t* _values;
+            bool* _active;
+        };
+
+        MuxResolver() = default;
+        MuxResolver(const std::vector<SignalImpl>& signals);
+
+        // decodes the switches of the frame
+        void evaluate(const ISignal::Descriptor* descriptors, const void* bytes, State& state) const noexcept;
+        // same as evaluate, but the switches are decoded from a buffer of size bytes
+        void evaluate(const ISignal::Descriptor* descriptors, const void* bytes, std::size_t size, State& state) const noexcept;
+        // whether the signal is present in the frame state was evaluated for
+        bool active(const State& state, std::size_t signal) const noexcept;
+
+    private:
+        static constexpr uint32_t none = uint32_t(-1);
+
+        struct Range
+        {
+            uint64_t from;
+            uint64_t to;
+        };
+        // the switch must be present and have one of the values
+        struct Condition
+        {
+            uint32_t node;
+            // switch values up to 255 are looked up in the bitset, others in the sorted ranges
+            uint64_t bitset[4];
+            bool bitset_only;
+            uint32_t ranges_begin;
+            uint32_t ranges_end;
+        };
+        struct Conditions
+        {
+            uint32_t begin;
+            uint32_t end;
+            // the signal can never be present (unknown switch, cycle, no multiplexer switch)
+            bool never;
+        };
+        struct Node
+        {
+            uint32_t signal;
+        };
+
+        bool check(const State& state, const Conditions& conditions) const noexcept;
+
+        // switches in the order they are evaluated
+        std::vector<Node> _nodes;
+        // per signal
+        std::vector<Conditions> _signal_conditions;
+        std::vector<Condition> _conditions;
+        std::vector<Range> _ranges;
+    };
+}
@@ -1,8 +1,10 @@
 #include <algorithm>
 #include <fstream>
 #include <iomanip>
+#include <functional>
 #include "dbcppp/Network.h"
 #include "NetworkImpl.h"
+#include "Jit.h"
 
 using namespace dbcppp;
 
@@ -101,7 +103,9 @@ NetworkImpl::NetworkImpl(
     , _attribute_defaults(std::move(attribute_defaults))
     , _attribute_values(std::move(attribute_values))
     , _comment(std::move(comment))
-{}
+{
+    buildIndices();
+}
 std::unique_ptr<INetwork> NetworkImpl::Clone() const
 {
     return std::make_unique<NetworkImpl>(*this);
@@ -184,18 +188,55 @@ const std::string& NetworkImpl::Comment() const
 }
 const IMessage* NetworkImpl::ParentMessage(const ISignal* sig) const
 {
-    const IMessage* parent = nullptr;
-    for (const auto& msg : _messages)
+    auto handle = SignalHandleOf(sig);
+    return handle ? &_messages[handle->message] : nullptr;
+}
+std::optional<std::size_t> NetworkImpl::MessageIndexOf(const IMessage* msg) const
+{
+    // std::less gives a total order also for pointers into different arrays
+    std::less<const IMessage*> less;
+    if (_messages.empty() || less(msg, &_messages.front()) || less(&_messages.back(), msg))
     {
-        auto iter = std::find_if(msg.signals().begin(), msg.signals().end(),
-            [&](const SignalImpl& other) { return &other == sig; });
-        if (iter != msg.signals().end())
-        {
-            parent = &msg;
-            break;
-        }
+        return std::nullopt;
+    }
+    return static_cast<const MessageImpl*>(msg) - _messages.data();
+}
+std::optional<INetwork::SignalHandle> NetworkImpl::SignalHandleOf(const ISignal* sig) const
+{
+    if (sig == nullptr)
+    {
+        return std::nullopt;
+    }
+    // the signal knows the index of its message, which only has to be verified
+    uint32_t message = static_cast<const SignalImpl*>(sig)->_message_index;
+    if (message >= _messages.size())
+    {
+        return std::nullopt;
+    }
+    const auto& signals = _messages[message].signals();
+    std::less<const ISignal*> less;
+    if (signals.empty() || less(sig, &signals.front()) || less(&signals.back(), sig))
+    {
+        return std::nullopt;
+    }
+    return SignalHandle{message, uint32_t(static_cast<const SignalImpl*>(sig) - signals.data())};
+}
+const ISignal& NetworkImpl::SignalByHandle(SignalHandle handle) const
+{
+    return _messages[handle.message].signals()[handle.signal];
+}
+const IMessage* NetworkImpl::MessageById(uint64_t id) const
+{
+    uint32_t i = _message_index.find(id);
+    return i != MessageIndex::none ? &_messages[i] : nullptr;
+}
+void NetworkImpl::buildIndices()
+{
+    _message_index = MessageIndex(_messages);
+    for (uint32_t i = 0; i < _messages.size(); i++)
+    {
+        _messages[i].setMessageIndex(i);
     }
-    return parent;
 }
 std::string& NetworkImpl::version()
 {
@@ -221,6 +262,10 @@ std::vector<MessageImpl>& NetworkImpl::messages()
 {
     return _messages;
 }
+const std::vector<MessageImpl>& NetworkImpl::messages() const
+{
+    return _messages;
+}
 std::vector<EnvironmentVariableImpl>& NetworkImpl::environmentVariables()
 {
     return _environment_variables;
@@ -261,6 +306,7 @@ void INetwork::Merge(std::unique_ptr<INetwork>&& other)
     {
         self.messages().push_back(std::move(m));
     }
+    self.buildIndices();
     for (auto& ev : o.environmentVariables())
     {
         self.environmentVariables().push_back(std::move(ev));
@@ -279,6 +325,11 @@ void INetwork::Merge(std::unique_ptr<INetwork>&& other)
     }
     other.reset(nullptr);
 }
+bool INetwork::CompileJit()
+{
+    auto& self = static_cast<NetworkImpl&>(*this);
+    return jit_compile_messages(self.messages());
+}
 bool NetworkImpl::operator==(const INetwork& rhs) const
 {
     bool equal = true;
@@ -8,6 +8,7 @@
 #include "SignalTypeImpl.h"
 #include "AttributeDefinitionImpl.h"
 #include "AttributeImpl.h"
+#include "MessageIndex.h"
 
 namespace dbcppp
 {
@@ -51,6 +52,10 @@ namespace dbcppp
         virtual const std::string& Comment() const override;
         
         virtual const IMessage* ParentMessage(const ISignal* sig) const override;
+        virtual std::optional<std::size_t> MessageIndexOf(const IMessage* msg) const override;
+        virtual std::optional<SignalHandle> SignalHandleOf(const ISignal* sig) const override;
+        virtual const ISignal& SignalByHandle(SignalHandle handle) const override;
+        virtual const IMessage* MessageById(uint64_t id) const override;
         
         virtual bool operator==(const INetwork& rhs) const override;
         virtual bool operator!=(const INetwork& rhs) const override;
@@ -61,12 +66,16 @@ namespace dbcppp
         std::vector<NodeImpl>& nodes();
         std::vector<ValueTableImpl>& valueTables();
         std::vector<MessageImpl>& messages();
+        const std::vector<MessageImpl>& messages() const;
         std::vector<EnvironmentVariableImpl>& environmentVariables();
         std::vector<AttributeDefinitionImpl>& attributeDefinitions();
         std::vector<AttributeImpl>& attributeDefaults();
         std::vector<AttributeImpl>& attributeValues();
         std::string& comment();
 
+        // has to be called after the messages were changed
+        void buildIndices();
+
     private:
         std::string _version;
         std::vector<std::string> _new_symbols;
@@ -74,6 +83,7 @@ namespace dbcppp
         std::vector<NodeImpl> _nodes;
         std::vector<ValueTableImpl> _value_tables;
         std::vector<MessageImpl> _messages;
+        MessageIndex _message_index;
         std::vector<EnvironmentVariableImpl> _environment_variables;
         std::vector<AttributeDefinitionImpl> _attribute_definitions;
         std::vector<AttributeImpl> _attribute_defaults;
@@ -0,0 +1,425 @@
+#include <algorithm>
+#include <optional>
+#include <cmath>
+#include <cctype>
+#include <cstdlib>
+#include "PredicateImpl.h"
+
+using namespace dbcppp;
+
+namespace
+{
+    using Node = PredicateImpl::Node;
+    using ENodeKind = PredicateImpl::ENodeKind;
+    using EOperator = PredicateImpl::EOperator;
+    using Comparison = PredicateImpl::Comparison;
+
+    // raw values of integer signals are handled as ordinals, signed values are shifted into the unsigned
+    // range by flipping the sign bit, so both keep their order when they are compared as uint64_t
+    struct Domain
+    {
+        const ISignal& sig;
+        uint64_t sign_flip;
+        uint64_t min;
+        uint64_t max;
+
+        Domain(const ISignal& sig)
+            : sig(sig)
+        {
+            const uint64_t n = sig.BitSize();
+            const uint64_t mask = n >= 64 ? ~0ull : (1ull << n) - 1;
+            if (sig.ValueType() == ISignal::EValueType::Signed)
+            {
+                sign_flip = 1ull << 63;
+                min = sign_flip - (mask >> 1) - 1;
+                max = sign_flip + (mask >> 1);
+            }
+            else
+            {
+                sign_flip = 0;
+                min = 0;
+                max = mask;
+            }
+        }
+        double phys(uint64_t ordinal) const
+        {
+            return sig.RawToPhys(ordinal ^ sign_flip);
+        }
+        // RawToPhys is monotonic in the raw value, so each of the conditions used here is false for the
+        // ordinals in front of some ordinal and true from it on, which a binary search finds
+        template <class Condition>
+        std::optional<uint64_t> first(Condition&& condition) const
+        {
+            if (!condition(phys(max)))
+            {
+                return std::nullopt;
+            }
+            uint64_t lo = min;
+            uint64_t hi = max;
+            while (lo < hi)
+            {
+                uint64_t mid = lo + (hi - lo) / 2;
+                if (condition(phys(mid)))
+                {
+                    hi = mid;
+                }
+                else
+                {
+                    lo = mid + 1;
+                }
+            }
+            return lo;
+        }
+    };
+    // [lo, hi] with lo > hi for the empty range
+    struct Range
+    {
+        uint64_t lo;
+        uint64_t hi;
+    };
+    const Range empty_range = {1, 0};
+
+    // the ordinals for which the comparison holds form one range, because RawToPhys is monotonic
+    Range raw_range(const Domain& d, EOperator op, double t)
+    {
+        // ordinals from first on
+        auto from =
+            [&](std::optional<uint64_t> first) -> Range
+            {
+                return first ? Range{*first, d.max} : empty_range;
+            };
+        // ordinals in front of first
+        auto below =
+            [&](std::optional<uint64_t> first) -> Range
+            {
+                if (!first)
+                {
+                    return {d.min, d.max};
+                }
+                return *first == d.min ? empty_range : Range{d.min, *first - 1};
+            };
+        auto intersect =
+            [](Range a, Range b) -> Range
+            {
+                Range r{std::max(a.lo, b.lo), std::min(a.hi, b.hi)};
+                return r.lo <= r.hi ? r : empty_range;
+            };
+        auto gt = [&](double p) { return p > t; };
+        auto ge = [&](double p) { return p >= t; };
+        auto lt = [&](double p) { return p < t; };
+        auto le = [&](double p) { return p <= t; };
+        if (d.sig.Factor() >= 0)
+        {
+            switch (op)
+            {
+            case EOperator::Greater:      return from(d.first(gt));
+            case EOperator::GreaterEqual: return from(d.first(ge));
+            case EOperator::Less:         return below(d.first(ge));
+            case EOperator::LessEqual:    return below(d.first(gt));
+            default:                      return intersect(from(d.first(ge)), below(d.first(gt)));
+            }
+        }
+        switch (op)
+        {
+        case EOperator::Greater:      return below(d.first(le));
+        case EOperator::GreaterEqual: return below(d.first(lt));
+        case EOperator::Less:         return from(d.first(lt));
+        case EOperator::LessEqual:    return from(d.first(le));
+        default:                      return intersect(from(d.first(le)), below(d.first(lt)));
+        }
+    }
+
+    class Parser
+    {
+    public:
+        Parser(const IMessage& message, std::string_view text)
+            : _message(message)
+            , _text(text)
+            , _pos(0)
+        {}
+        bool parse()
+        {
+            uint32_t root;
+            if (!parse_or(root))
+            {
+                return false;
+            }
+            skip_space();
+            if (_pos != _text.size())
+            {
+                return fail("unexpected '" + std::string(_text.substr(_pos, 1)) + "'");
+            }
+            _root = root;
+            return true;
+        }
+        std::vector<Node> _nodes;
+        uint32_t _root;
+        std::vector<Comparison> _comparisons;
+        std::string _error;
+
+    private:
+        bool fail(std::string message)
+        {
+            _error = message + " at position " + std::to_string(_pos);
+            return false;
+        }
+        void skip_space()
+        {
+            while (_pos < _text.size() && std::isspace(static_cast<unsigned char>(_text[_pos])))
+            {
+                _pos++;
+            }
+        }
+        bool accept(std::string_view token)
+        {
+            skip_space();
+            if (_text.substr(_pos, token.size()) == token)
+            {
+                _pos += token.size();
+                return true;
+            }
+            return false;
+        }
+        uint32_t push(Node node)
+        {
+            _nodes.push_back(node);
+            return uint32_t(_nodes.size() - 1);
+        }
+        bool parse_or(uint32_t& node)
+        {
+            if (!parse_and(node))
+            {
+                return false;
+            }
+            while (accept("||"))
+            {
+                uint32_t rhs;
+                if (!parse_and(rhs))
+                {
+                    return false;
+                }
+                node = push({ENodeKind::Or, node, rhs, false});
+            }
+            return true;
+        }
+        bool parse_and(uint32_t& node)
+        {
+            if (!parse_unary(node))
+            {
+                return false;
+            }
+            while (accept("&&"))
+            {
+                uint32_t rhs;
+                if (!parse_unary(rhs))
+                {
+                    return false;
+                }
+                node = push({ENodeKind::And, node, rhs, false});
+            }
+            return true;
+        }
+        bool parse_unary(uint32_t& node)
+        {
+            // "!" but not "!="
+            skip_space();
+            if (_text.substr(_pos, 1) == "!" && _text.substr(_pos, 2) != "!=")
+            {
+                _pos++;
+                uint32_t operand;
+                if (!parse_unary(operand))
+                {
+                    return false;
+                }
+                node = push({ENodeKind::Not, operand, 0, false});
+                return true;
+            }
+            if (accept("("))
+            {
+                if (!parse_or(node))
+                {
+                    return false;
+                }
+                return accept(")") || fail("expected ')'");
+            }
+            return parse_comparison(node);
+        }
+        bool parse_comparison(uint32_t& node)
+        {
+            skip_space();
+            std::size_t begin = _pos;
+            while (_pos < _text.size() && (std::isalnum(static_cast<unsigned char>(_text[_pos])) || _text[_pos] == '_'))
+            {
+                _pos++;
+            }
+            if (begin == _pos)
+            {
+                return fail("expected a signal name");
+            }
+            std::string_view name = _text.substr(begin, _pos - begin);
+            EOperator op;
+            // the two character operators first
+            if (accept("=="))      op = EOperator::Equal;
+            else if (accept("!=")) op = EOperator::NotEqual;
+            else if (accept("<=")) op = EOperator::LessEqual;
+            else if (accept(">=")) op = EOperator::GreaterEqual;
+            else if (accept("<"))  op = EOperator::Less;
+            else if (accept(">"))  op = EOperator::Greater;
+            else return fail("expected a comparison operator");
+            skip_space();
+            if (_pos < _text.size() && (_text[_pos] == '\'' || _text[_pos] == '"'))
+            {
+                char quote = _text[_pos++];
+                std::size_t end = _text.find(quote, _pos);
+                if (end == std::string_view::npos)
+                {
+                    return fail("unterminated label");
+                }
+                std::string_view label = _text.substr(_pos, end - _pos);
+                _pos = end + 1;
+                if (op != EOperator::Equal && op != EOperator::NotEqual)
+                {
+                    return fail("labels can only be compared with == and !=");
+                }
+                node = compile_label(name, op, label);
+                return true;
+            }
+            std::string number(_text.substr(_pos));
+            char* end;
+            double value = std::strtod(number.c_str(), &end);
+            if (end == number.c_str())
+            {
+                return fail("expected a number or a label");
+            }
+            // strtod accepts nan and inf, the ranges can't be derived from them
+            if (!std::isfinite(value))
+            {
+                return fail("expected a finite number");
+            }
+            _pos += end - number.c_str();
+            node = compile_number(name, op, value);
+            return true;
+        }
+        // index of the signal in the message or uint32_t(-1)
+        uint32_t find(std::string_view name) const
+        {
+            for (uint32_t i = 0; i < _message.Signals_Size(); i++)
+            {
+                if (_message.Signals_Get(i).Name() == name)
+                {
+                    return i;
+                }
+            }
+            return uint32_t(-1);
+        }
+        uint32_t compile(uint32_t signal, const Domain& d, Range range, bool inside)
+        {
+            _comparisons.push_back({signal, false, EOperator::Equal, 0.0, d.sign_flip, range.lo, range.hi, inside});
+            return push({ENodeKind::Compare, uint32_t(_comparisons.size() - 1), 0, false});
+        }
+        uint32_t compile_label(std::string_view name, EOperator op, std::string_view label)
+        {
+            uint32_t signal = find(name);
+            auto value = signal != uint32_t(-1) ? _message.Signals_Get(signal).DescriptionToValue(label) : std::nullopt;
+            if (!value)
+            {
+                return push({ENodeKind::Constant, 0, 0, false});
+            }
+            Domain d(_message.Signals_Get(signal));
+            uint64_t ordinal = uint64_t(*value) ^ d.sign_flip;
+            // a label whose value doesn't fit into the signal is never equal
+            Range range = ordinal >= d.min && ordinal <= d.max ? Range{ordinal, ordinal} : empty_range;
+            return compile(signal, d, range, op == EOperator::Equal);
+        }
+        uint32_t compile_number(std::string_view name, EOperator op, double value)
+        {
+            uint32_t signal = find(name);
+            if (signal == uint32_t(-1))
+            {
+                return push({ENodeKind::Constant, 0, 0, false});
+            }
+            const ISignal* sig = &_message.Signals_Get(signal);
+            if (sig->ExtendedValueType() != ISignal::EExtendedValueType::Integer)
+            {
+                _comparisons.push_back({signal, true, op, value, 0, 0, 0, true});
+                return push({ENodeKind::Compare, uint32_t(_comparisons.size() - 1), 0, false});
+            }
+            Domain d(*sig);
+            if (op == EOperator::NotEqual)
+            {
+                return compile(signal, d, raw_range(d, EOperator::Equal, value), false);
+            }
+            return compile(signal, d, raw_range(d, op, value), true);
+        }
+
+        const IMessage& _message;
+        std::string_view _text;
+        std::size_t _pos;
+    };
+}
+
+std::unique_ptr<IPredicate> IPredicate::Create(const IMessage& message, std::string_view expression, std::string* error)
+{
+    Parser parser(message, expression);
+    if (!parser.parse())
+    {
+        if (error)
+        {
+            *error = parser._error;
+        }
+        return nullptr;
+    }
+    return std::make_unique<PredicateImpl>(message, std::move(parser._nodes), std::move(parser._comparisons), parser._root);
+}
+PredicateImpl::PredicateImpl(const IMessage& message, std::vector<Node>&& nodes, std::vector<Comparison>&& comparisons, uint32_t root)
+    : _message(&message)
+    , _nodes(std::move(nodes))
+    , _comparisons(std::move(comparisons))
+    , _root(root)
+{}
+const IMessage& PredicateImpl::Message() const
+{
+    return *_message;
+}
+bool PredicateImpl::Evaluate(const IMessage::DecodeResult& result) const
+{
+    return evaluate(_root, result);
+}
+bool PredicateImpl::evaluate(uint32_t node, const IMessage::DecodeResult& result) const noexcept
+{
+    const Node& n = _nodes[node];
+    switch (n.kind)
+    {
+    case ENodeKind::Or:       return evaluate(n.lhs, result) || evaluate(n.rhs, result);
+    case ENodeKind::And:      return evaluate(n.lhs, result) && evaluate(n.rhs, result);
+    case ENodeKind::Not:      return !evaluate(n.lhs, result);
+    case ENodeKind::Compare:  return compare(_comparisons[n.lhs], result);
+    case ENodeKind::Constant: return n.value;
+    }
+    return false;
+}
+bool PredicateImpl::compare(const Comparison& comparison, const IMessage::DecodeResult& result) const noexcept
+{
+    // Decode returns the signals in the order of Signals()
+    auto iter = std::lower_bound(result.begin(), result.end(), comparison.signal,
+        [](const IMessage::DecodeResult::Entry& entry, uint32_t signal) { return entry.signal < signal; });
+    if (iter == result.end() || iter->signal != comparison.signal)
+    {
+        return false;
+    }
+    if (comparison.physical)
+    {
+        double phys = _message->Signals_Get(comparison.signal).RawToPhys(iter->raw);
+        switch (comparison.op)
+        {
+        case EOperator::Equal:        return phys == comparison.threshold;
+        case EOperator::NotEqual:     return phys != comparison.threshold;
+        case EOperator::Less:         return phys < comparison.threshold;
+        case EOperator::LessEqual:    return phys <= comparison.threshold;
+        case EOperator::Greater:      return phys > comparison.threshold;
+        case EOperator::GreaterEqual: return phys >= comparison.threshold;
+        }
+    }
+    uint64_t ordinal = iter->raw ^ comparison.sign_flip;
+    return (ordinal >= comparison.lo && ordinal <= comparison.hi) == comparison.inside;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include "dbcppp/Predicate.h"
+
+namespace dbcppp
+{
+    class PredicateImpl final
+        : public IPredicate
+    {
+    public:
+        enum class ENodeKind
+        {
+            Or,
+            And,
+            Not,
+            Compare,
+            Constant
+        };
+        enum class EOperator
+        {
+            Equal,
+            NotEqual,
+            Less,
+            LessEqual,
+            Greater,
+            GreaterEqual
+        };
+        struct Node
+        {
+            ENodeKind kind;
+            // operands of Or, And and Not, index of the comparison for Compare
+            uint32_t lhs;
+            uint32_t rhs;
+            bool value;
+        };
+        struct Comparison
+        {
+            uint32_t signal;
+            // float and double signals are compared after RawToPhys
+            bool physical;
+            EOperator op;
+            double threshold;
+            // integer signals: the raw value mapped to an unsigned ordinal (raw ^ sign_flip)
+            // must be in [lo, hi] if inside is set and outside of it otherwise
+            uint64_t sign_flip;
+            uint64_t lo;
+            uint64_t hi;
+            bool inside;
+        };
+
+        PredicateImpl(const IMessage& message, std::vector<Node>&& nodes, std::vector<Comparison>&& comparisons, uint32_t root);
+
+        virtual const IMessage& Message() const override;
+        virtual bool Evaluate(const IMessage::DecodeResult& result) const override;
+
+    private:
+        bool evaluate(uint32_t node, const IMessage::DecodeResult& result) const noexcept;
+        bool compare(const Comparison& comparison, const IMessage::DecodeResult& result) const noexcept;
+
+        const IMessage* _message;
+        std::vector<Node> _nodes;
+        std::vector<Comparison> _comparisons;
+        uint32_t _root;
+    };
+}
@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <unordered_map>
+#include "ProjectionImpl.h"
+
+using namespace dbcppp;
+
+namespace
+{
+    // span of ids which is always stored densely, covers all standard (11 bit) ids
+    constexpr uint64_t min_dense_span = 2048;
+}
+
+std::unique_ptr<IProjection> IProjection::Create(const INetwork& network, const std::vector<const ISignal*>& signals)
+{
+    const auto& messages = static_cast<const NetworkImpl&>(network).messages();
+    std::vector<ProjectionImpl::Column> columns;
+    for (const ISignal* sig : signals)
+    {
+        for (const auto& msg : messages)
+        {
+            const auto& sigs = msg.signals();
+            if (!sigs.empty() && sig >= &sigs.front() && sig <= &sigs.back())
+            {
+                columns.push_back({&msg, uint32_t(static_cast<const SignalImpl*>(sig) - &sigs.front())});
+                break;
+            }
+        }
+    }
+    return std::make_unique<ProjectionImpl>(static_cast<const NetworkImpl&>(network), std::move(columns));
+}
+std::unique_ptr<IProjection> IProjection::Create(const INetwork& network, const std::vector<std::string>& signal_names)
+{
+    const auto& messages = static_cast<const NetworkImpl&>(network).messages();
+    std::vector<ProjectionImpl::Column> columns;
+    for (const auto& name : signal_names)
+    {
+        for (const auto& msg : messages)
+        {
+            const auto& sigs = msg.signals();
+            for (uint32_t i = 0; i < sigs.size(); i++)
+            {
+                if (sigs[i].Name() == name)
+                {
+                    columns.push_back({&msg, i});
+                }
+            }
+        }
+    }
+    return std::make_unique<ProjectionImpl>(static_cast<const NetworkImpl&>(network), std::move(columns));
+}
+ProjectionImpl::ProjectionImpl(const NetworkImpl& network, std::vector<Column>&& columns)
+    : _columns(std::move(columns))
+    , _dense_base(0)
+    , _max_values(0)
+{
+    // a frame is decoded as the network's first message with its id, columns of later messages
+    // with the same id are never decoded
+    std::unordered_map<uint64_t, const MessageImpl*> first_by_id;
+    for (const auto& msg : network.messages())
+    {
+        first_by_id.emplace(msg.Id(), &msg);
+    }
+    std::vector<uint32_t> order(_columns.size());
+    for (uint32_t i = 0; i < order.size(); i++)
+    {
+        order[i] = i;
+    }
+    // group by message id
+    std::stable_sort(order.begin(), order.end(),
+        [&](uint32_t lhs, uint32_t rhs)
+        {
+            const Column& l = _columns[lhs];
+            const Column& r = _columns[rhs];
+            if (l.message->Id() != r.message->Id())
+            {
+                return l.message->Id() < r.message->Id();
+            }
+            return l.signal < r.signal;
+        });
+    for (auto i : order)
+    {
+        const Column& column = _columns[i];
+        if (first_by_id[column.message->Id()] != column.message)
+        {
+            continue;
+        }
+        if (_plans.empty() || _plans.back().id != column.message->Id())
+        {
+            uint32_t begin = uint32_t(_entries.size());
+            _plans.push_back({column.message->Id(), column.message, begin, begin, false});
+        }
+        Plan& plan = _plans.back();
+        const SignalImpl& sig = column.message->signals()[column.signal];
+        _entries.push_back({sig.descriptor(), i, column.signal});
+        plan.end++;
+        plan.multiplexed |= sig.MultiplexerIndicator() == ISignal::EMultiplexer::MuxValue;
+        _max_values = std::max<std::size_t>(_max_values, plan.end - plan.begin);
+    }
+    if (!_plans.empty())
+    {
+        uint64_t span = _plans.back().id - _plans.front().id;
+        if (span < std::max<uint64_t>(min_dense_span, 4 * _plans.size()))
+        {
+            _dense_base = _plans.front().id;
+            _dense.assign(span + 1, none);
+            for (uint32_t i = 0; i < _plans.size(); i++)
+            {
+                _dense[_plans[i].id - _dense_base] = i;
+            }
+        }
+    }
+}
+const ISignal& ProjectionImpl::Columns_Get(std::size_t i) const
+{
+    return _columns[i].message->signals()[_columns[i].signal];
+}
+uint64_t ProjectionImpl::Columns_Size() const
+{
+    return _columns.size();
+}
+const IMessage& ProjectionImpl::ColumnMessage(std::size_t i) const
+{
+    return *_columns[i].message;
+}
+const ProjectionImpl::Plan* ProjectionImpl::find(uint64_t message_id) const noexcept
+{
+    if (!_dense.empty())
+    {
+        uint64_t i = message_id - _dense_base;
+        return i < _dense.size() && _dense[i] != none ? &_plans[_dense[i]] : nullptr;
+    }
+    auto iter = std::lower_bound(_plans.begin(), _plans.end(), message_id,
+        [](const Plan& plan, uint64_t id) { return plan.id < id; });
+    return iter != _plans.end() && iter->id == message_id ? &*iter : nullptr;
+}
+bool ProjectionImpl::Covers(uint64_t message_id) const
+{
+    return find(message_id) != nullptr;
+}
+std::size_t ProjectionImpl::MaxValues() const
+{
+    return _max_values;
+}
+std::size_t ProjectionImpl::Decode(uint64_t message_id, const void* bytes, Value* values) const
+{
+    const Plan* plan = find(message_id);
+    if (plan == nullptr)
+    {
+        return 0;
+    }
+    std::size_t n = 0;
+    if (!plan->multiplexed)
+    {
+        for (uint32_t i = plan->begin; i < plan->end; i++)
+        {
+            values[n++] = {_entries[i].column, _entries[i].descriptor.Decode(bytes)};
+        }
+        return n;
+    }
+    const MessageImpl& msg = *plan->message;
+    if (msg.muxDispatch().extended())
+    {
+        MuxResolver::State state(msg.muxResolver());
+        msg.muxResolver().evaluate(msg.SignalDescriptors(), bytes, state);
+        for (uint32_t i = plan->begin; i < plan->end; i++)
+        {
+            if (msg.muxResolver().active(state, _entries[i].signal))
+            {
+                values[n++] = {_entries[i].column, _entries[i].descriptor.Decode(bytes)};
+            }
+        }
+        return n;
+    }
+    const uint32_t* begin;
+    const uint32_t* end;
+    msg.muxDispatch().lookup(msg.SignalDescriptors(), bytes, begin, end);
+    for (uint32_t i = plan->begin; i < plan->end; i++)
+    {
+        // both are sorted by the signal index
+        begin = std::lower_bound(begin, end, _entries[i].signal);
+        if (begin != end && *begin == _entries[i].signal)
+        {
+            values[n++] = {_entries[i].column, _entries[i].descriptor.Decode(bytes)};
+        }
+    }
+    return n;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include "dbcppp/Projection.h"
+#include "NetworkImpl.h"
+
+namespace dbcppp
+{
+    class ProjectionImpl final
+        : public IProjection
+    {
+    public:
+        struct Column
+        {
+            const MessageImpl* message;
+            uint32_t signal;
+        };
+
+        ProjectionImpl(const NetworkImpl& network, std::vector<Column>&& columns);
+
+        virtual const ISignal& Columns_Get(std::size_t i) const override;
+        virtual uint64_t Columns_Size() const override;
+        virtual const IMessage& ColumnMessage(std::size_t i) const override;
+
+        virtual bool Covers(uint64_t message_id) const override;
+        virtual std::size_t MaxValues() const override;
+        virtual std::size_t Decode(uint64_t message_id, const void* bytes, Value* values) const override;
+
+    private:
+        struct Entry
+        {
+            // copy of the signal's descriptor, so a plan's entries are decoded from one contiguous array
+            ISignal::Descriptor descriptor;
+            uint32_t column;
+            uint32_t signal;
+        };
+        struct Plan
+        {
+            uint64_t id;
+            const MessageImpl* message;
+            uint32_t begin;
+            uint32_t end;
+            // one of the entries is multiplexed, so the presence has to be checked
+            bool multiplexed;
+        };
+        static constexpr uint32_t none = uint32_t(-1);
+
+        const Plan* find(uint64_t message_id) const noexcept;
+
+        std::vector<Column> _columns;
+        std::vector<Entry> _entries;
+        // sorted by id
+        std::vector<Plan> _plans;
+        // if the ids are close together _dense[id - _dense_base] is the index of the plan or none
+        std::vector<uint32_t> _dense;
+        uint64_t _dense_base;
+        std::size_t _max_values;
+    };
+}
@@ -1,42 +1,51 @@
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <limits>
 #include "Helper.h"
 #include "SignalImpl.h"
+#include "SignalSIMD.h"
 
 using namespace dbcppp;
 
-enum class Alignment
+// the decode fields are passed by value so the batch kernels can keep them in registers
+// instead of reloading them from the SignalImpl for every frame
+struct DecodeLayout
 {
-    size_inbetween_first_64_bit,
-    signal_exceeds_64_bit_size_but_signal_fits_into_64_bit,
-    signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit
+    uint64_t mask;
+    uint64_t mask_signed;
+    uint64_t fixed_start_bit_0;
+    uint64_t fixed_start_bit_1;
+    uint64_t byte_pos;
 };
-
+inline DecodeLayout decode_layout(const SignalImpl* sigi) noexcept
+{
+    return {sigi->_mask, sigi->_mask_signed, sigi->_fixed_start_bit_0, sigi->_fixed_start_bit_1, sigi->_byte_pos};
+}
 template <Alignment aAlignment, ISignal::EByteOrder aByteOrder, ISignal::EValueType aValueType, ISignal::EExtendedValueType aExtendedValueType>
-ISignal::raw_t template_decode(const ISignal* sig, const void* nbytes) noexcept
+inline ISignal::raw_t decode_frame(const DecodeLayout& layout, const void* nbytes) noexcept
 {
-    const SignalImpl* sigi = static_cast<const SignalImpl*>(sig);
     uint64_t data;
     if constexpr (aAlignment == Alignment::signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit)
     {
-        data = *reinterpret_cast<const uint64_t*>(&reinterpret_cast<const uint8_t*>(nbytes)[sigi->_byte_pos]);
-        uint64_t data1 = reinterpret_cast<const uint8_t*>(nbytes)[sigi->_byte_pos + 8];
+        data = *reinterpret_cast<const uint64_t*>(&reinterpret_cast<const uint8_t*>(nbytes)[layout.byte_pos]);
+        uint64_t data1 = reinterpret_cast<const uint8_t*>(nbytes)[layout.byte_pos + 8];
         if constexpr (aByteOrder == ISignal::EByteOrder::BigEndian)
         {
             //native_to_big_inplace(data);
             native_to_big_inplace(data);
-            data &= sigi->_mask;
-            data <<= sigi->_fixed_start_bit_0;
-            data1 >>= sigi->_fixed_start_bit_1;
+            data &= layout.mask;
+            data <<= layout.fixed_start_bit_0;
+            data1 >>= layout.fixed_start_bit_1;
             data |= data1;
         }
         else
         {
             //native_to_little_inplace(data);
             native_to_little_inplace(data);
-            data >>= sigi->_fixed_start_bit_0;
-            data1 &= sigi->_mask;
-            data1 <<= sigi->_fixed_start_bit_1;
+            data >>= layout.fixed_start_bit_0;
+            data1 &= layout.mask;
+            data1 <<= layout.fixed_start_bit_1;
             data |= data1;
         }
         if constexpr (aExtendedValueType == ISignal::EExtendedValueType::Float ||
@@ -46,9 +55,9 @@ ISignal::raw_t template_decode(const ISignal* sig, const void* nbytes) noexcept
         }
         if constexpr (aValueType == ISignal::EValueType::Signed)
         {
-            if (data & sigi->_mask_signed)
+            if (data & layout.mask_signed)
             {
-                data |= sigi->_mask_signed;
+                data |= layout.mask_signed;
             }
         }
         return data;
@@ -61,7 +70,7 @@ ISignal::raw_t template_decode(const ISignal* sig, const void* nbytes) noexcept
         }
         else
         {
-            data = *reinterpret_cast<const uint64_t*>(&reinterpret_cast<const uint8_t*>(nbytes)[sigi->_byte_pos]);
+            data = *reinterpret_cast<const uint64_t*>(&reinterpret_cast<const uint8_t*>(nbytes)[layout.byte_pos]);
         }
         if constexpr (aByteOrder == ISignal::EByteOrder::BigEndian)
         {
@@ -77,9 +86,9 @@ ISignal::raw_t template_decode(const ISignal* sig, const void* nbytes) noexcept
         {
             return data;
         }
-        data >>= sigi->_fixed_start_bit_0;
+        data >>= layout.fixed_start_bit_0;
     }
-    data &= sigi->_mask;
+    data &= layout.mask;
     if constexpr (aExtendedValueType == ISignal::EExtendedValueType::Float)
     {
         return data;
@@ -88,13 +97,59 @@ ISignal::raw_t template_decode(const ISignal* sig, const void* nbytes) noexcept
     {
         // bit extending
         // trust the compiler to optimize this
-        if (data & sigi->_mask_signed)
+        if (data & layout.mask_signed)
         {
-            data |= sigi->_mask_signed;
+            data |= layout.mask_signed;
         }
     }
     return data;
 }
+template <Alignment aAlignment, ISignal::EByteOrder aByteOrder, ISignal::EValueType aValueType, ISignal::EExtendedValueType aExtendedValueType>
+ISignal::raw_t template_decode(const ISignal* sig, const void* nbytes) noexcept
+{
+    const SignalImpl* sigi = static_cast<const SignalImpl*>(sig);
+    return decode_frame<aAlignment, aByteOrder, aValueType, aExtendedValueType>(decode_layout(sigi), nbytes);
+}
+template <Alignment aAlignment, ISignal::EByteOrder aByteOrder, ISignal::EValueType aValueType, ISignal::EExtendedValueType aExtendedValueType>
+ISignal::raw_t template_decode_partial(const ISignal* sig, const void* nbytes, std::size_t size) noexcept
+{
+    // only called if the buffer ends before the word decode reads, so copy what
+    // is there into a zeroed buffer and decode from that instead
+    const SignalImpl* sigi = static_cast<const SignalImpl*>(sig);
+    DecodeLayout layout = decode_layout(sigi);
+    std::size_t pos = aAlignment == Alignment::size_inbetween_first_64_bit ? 0 : layout.byte_pos;
+    uint8_t buffer[16] = {};
+    if (size > pos)
+    {
+        std::memcpy(buffer, &reinterpret_cast<const uint8_t*>(nbytes)[pos], size - pos);
+    }
+    layout.byte_pos = 0;
+    return decode_frame<aAlignment, aByteOrder, aValueType, aExtendedValueType>(layout, buffer);
+}
+template <Alignment aAlignment, ISignal::EByteOrder aByteOrder, ISignal::EValueType aValueType, ISignal::EExtendedValueType aExtendedValueType>
+void template_decode_batch(const ISignal* sig, const void* nbytes, std::size_t stride, std::size_t count, ISignal::raw_t* values) noexcept
+{
+    const SignalImpl* sigi = static_cast<const SignalImpl*>(sig);
+    const DecodeLayout layout = decode_layout(sigi);
+    const uint8_t* frame = reinterpret_cast<const uint8_t*>(nbytes);
+    std::size_t i = 0;
+    if (sigi->_simd_decode_batch)
+    {
+        i = sigi->_simd_decode_batch(sigi, frame, stride, count, values);
+        frame += i * stride;
+    }
+    for (; i < count; i++, frame += stride)
+    {
+        values[i] = decode_frame<aAlignment, aByteOrder, aValueType, aExtendedValueType>(layout, frame);
+    }
+}
+
+template <Alignment aAlignment, ISignal::EByteOrder aByteOrder, ISignal::EValueType aValueType, ISignal::EExtendedValueType aExtendedValueType>
+ISignal::raw_t template_decode_descriptor(const ISignal::Descriptor* desc, const void* nbytes) noexcept
+{
+    const DecodeLayout layout{desc->mask, desc->mask_signed, desc->fixed_start_bit_0, desc->fixed_start_bit_1, desc->byte_pos};
+    return decode_frame<aAlignment, aByteOrder, aValueType, aExtendedValueType>(layout, nbytes);
+}
 
 constexpr uint64_t enum_mask(Alignment a, ISignal::EByteOrder bo, ISignal::EValueType vt, ISignal::EExtendedValueType evt)
 {
@@ -177,6 +232,168 @@ decode_func_t make_decode(Alignment a, ISignal::EByteOrder bo, ISignal::EValueTy
     }
     return nullptr;
 }
+using decode_partial_func_t = ISignal::raw_t (*)(const ISignal*, const void*, std::size_t) noexcept;
+decode_partial_func_t make_decode_partial(Alignment a, ISignal::EByteOrder bo, ISignal::EValueType vt, ISignal::EExtendedValueType evt)
+{
+    constexpr auto si64b            = Alignment::size_inbetween_first_64_bit;
+    constexpr auto se64bsbsfi64b    = Alignment::signal_exceeds_64_bit_size_but_signal_fits_into_64_bit;
+    constexpr auto se64bsasdnfi64b  = Alignment::signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit;
+    constexpr auto le               = ISignal::EByteOrder::LittleEndian;
+    constexpr auto be               = ISignal::EByteOrder::BigEndian;
+    constexpr auto sig              = ISignal::EValueType::Signed;
+    constexpr auto usig             = ISignal::EValueType::Unsigned;
+    constexpr auto i                = ISignal::EExtendedValueType::Integer;
+    constexpr auto f                = ISignal::EExtendedValueType::Float;
+    constexpr auto d                = ISignal::EExtendedValueType::Double;
+    switch (enum_mask(a, bo, vt, evt))
+    {
+    case enum_mask(si64b, le, sig, i):            return template_decode_partial<si64b, le, sig, i>;
+    case enum_mask(si64b, le, sig, f):            return template_decode_partial<si64b, le, sig, f>;
+    case enum_mask(si64b, le, sig, d):            return template_decode_partial<si64b, le, sig, d>;
+    case enum_mask(si64b, le, usig, i):           return template_decode_partial<si64b, le, usig, i>;
+    case enum_mask(si64b, le, usig, f):           return template_decode_partial<si64b, le, usig, f>;
+    case enum_mask(si64b, le, usig, d):           return template_decode_partial<si64b, le, usig, d>;
+    case enum_mask(si64b, be, sig, i):            return template_decode_partial<si64b, be, sig, i>;
+    case enum_mask(si64b, be, sig, f):            return template_decode_partial<si64b, be, sig, f>;
+    case enum_mask(si64b, be, sig, d):            return template_decode_partial<si64b, be, sig, d>;
+    case enum_mask(si64b, be, usig, i):           return template_decode_partial<si64b, be, usig, i>;
+    case enum_mask(si64b, be, usig, f):           return template_decode_partial<si64b, be, usig, f>;
+    case enum_mask(si64b, be, usig, d):           return template_decode_partial<si64b, be, usig, d>;
+    case enum_mask(se64bsbsfi64b, le, sig, i):    return template_decode_partial<se64bsbsfi64b, le, sig, i>;
+    case enum_mask(se64bsbsfi64b, le, sig, f):    return template_decode_partial<se64bsbsfi64b, le, sig, f>;
+    case enum_mask(se64bsbsfi64b, le, sig, d):    return template_decode_partial<se64bsbsfi64b, le, sig, d>;
+    case enum_mask(se64bsbsfi64b, le, usig, i):   return template_decode_partial<se64bsbsfi64b, le, usig, i>;
+    case enum_mask(se64bsbsfi64b, le, usig, f):   return template_decode_partial<se64bsbsfi64b, le, usig, f>;
+    case enum_mask(se64bsbsfi64b, le, usig, d):   return template_decode_partial<se64bsbsfi64b, le, usig, d>;
+    case enum_mask(se64bsbsfi64b, be, sig, i):    return template_decode_partial<se64bsbsfi64b, be, sig, i>;
+    case enum_mask(se64bsbsfi64b, be, sig, f):    return template_decode_partial<se64bsbsfi64b, be, sig, f>;
+    case enum_mask(se64bsbsfi64b, be, sig, d):    return template_decode_partial<se64bsbsfi64b, be, sig, d>;
+    case enum_mask(se64bsbsfi64b, be, usig, i):   return template_decode_partial<se64bsbsfi64b, be, usig, i>;
+    case enum_mask(se64bsbsfi64b, be, usig, f):   return template_decode_partial<se64bsbsfi64b, be, usig, f>;
+    case enum_mask(se64bsbsfi64b, be, usig, d):   return template_decode_partial<se64bsbsfi64b, be, usig, d>;
+    case enum_mask(se64bsasdnfi64b, le, sig, i):  return template_decode_partial<se64bsasdnfi64b, le, sig, i>;
+    case enum_mask(se64bsasdnfi64b, le, sig, f):  return template_decode_partial<se64bsasdnfi64b, le, sig, f>;
+    case enum_mask(se64bsasdnfi64b, le, sig, d):  return template_decode_partial<se64bsasdnfi64b, le, sig, d>;
+    case enum_mask(se64bsasdnfi64b, le, usig, i): return template_decode_partial<se64bsasdnfi64b, le, usig, i>;
+    case enum_mask(se64bsasdnfi64b, le, usig, f): return template_decode_partial<se64bsasdnfi64b, le, usig, f>;
+    case enum_mask(se64bsasdnfi64b, le, usig, d): return template_decode_partial<se64bsasdnfi64b, le, usig, d>;
+    case enum_mask(se64bsasdnfi64b, be, sig, i):  return template_decode_partial<se64bsasdnfi64b, be, sig, i>;
+    case enum_mask(se64bsasdnfi64b, be, sig, f):  return template_decode_partial<se64bsasdnfi64b, be, sig, f>;
+    case enum_mask(se64bsasdnfi64b, be, sig, d):  return template_decode_partial<se64bsasdnfi64b, be, sig, d>;
+    case enum_mask(se64bsasdnfi64b, be, usig, i): return template_decode_partial<se64bsasdnfi64b, be, usig, i>;
+    case enum_mask(se64bsasdnfi64b, be, usig, f): return template_decode_partial<se64bsasdnfi64b, be, usig, f>;
+    case enum_mask(se64bsasdnfi64b, be, usig, d): return template_decode_partial<se64bsasdnfi64b, be, usig, d>;
+    }
+    return nullptr;
+}
+using decode_batch_func_t = void (*)(const ISignal*, const void*, std::size_t, std::size_t, ISignal::raw_t*) noexcept;
+decode_batch_func_t make_decode_batch(Alignment a, ISignal::EByteOrder bo, ISignal::EValueType vt, ISignal::EExtendedValueType evt)
+{
+    constexpr auto si64b            = Alignment::size_inbetween_first_64_bit;
+    constexpr auto se64bsbsfi64b    = Alignment::signal_exceeds_64_bit_size_but_signal_fits_into_64_bit;
+    constexpr auto se64bsasdnfi64b  = Alignment::signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit;
+    constexpr auto le               = ISignal::EByteOrder::LittleEndian;
+    constexpr auto be               = ISignal::EByteOrder::BigEndian;
+    constexpr auto sig              = ISignal::EValueType::Signed;
+    constexpr auto usig             = ISignal::EValueType::Unsigned;
+    constexpr auto i                = ISignal::EExtendedValueType::Integer;
+    constexpr auto f                = ISignal::EExtendedValueType::Float;
+    constexpr auto d                = ISignal::EExtendedValueType::Double;
+    switch (enum_mask(a, bo, vt, evt))
+    {
+    case enum_mask(si64b, le, sig, i):            return template_decode_batch<si64b, le, sig, i>;
+    case enum_mask(si64b, le, sig, f):            return template_decode_batch<si64b, le, sig, f>;
+    case enum_mask(si64b, le, sig, d):            return template_decode_batch<si64b, le, sig, d>;
+    case enum_mask(si64b, le, usig, i):           return template_decode_batch<si64b, le, usig, i>;
+    case enum_mask(si64b, le, usig, f):           return template_decode_batch<si64b, le, usig, f>;
+    case enum_mask(si64b, le, usig, d):           return template_decode_batch<si64b, le, usig, d>;
+    case enum_mask(si64b, be, sig, i):            return template_decode_batch<si64b, be, sig, i>;
+    case enum_mask(si64b, be, sig, f):            return template_decode_batch<si64b, be, sig, f>;
+    case enum_mask(si64b, be, sig, d):            return template_decode_batch<si64b, be, sig, d>;
+    case enum_mask(si64b, be, usig, i):           return template_decode_batch<si64b, be, usig, i>;
+    case enum_mask(si64b, be, usig, f):           return template_decode_batch<si64b, be, usig, f>;
+    case enum_mask(si64b, be, usig, d):           return template_decode_batch<si64b, be, usig, d>;
+    case enum_mask(se64bsbsfi64b, le, sig, i):    return template_decode_batch<se64bsbsfi64b, le, sig, i>;
+    case enum_mask(se64bsbsfi64b, le, sig, f):    return template_decode_batch<se64bsbsfi64b, le, sig, f>;
+    case enum_mask(se64bsbsfi64b, le, sig, d):    return template_decode_batch<se64bsbsfi64b, le, sig, d>;
+    case enum_mask(se64bsbsfi64b, le, usig, i):   return template_decode_batch<se64bsbsfi64b, le, usig, i>;
+    case enum_mask(se64bsbsfi64b, le, usig, f):   return template_decode_batch<se64bsbsfi64b, le, usig, f>;
+    case enum_mask(se64bsbsfi64b, le, usig, d):   return template_decode_batch<se64bsbsfi64b, le, usig, d>;
+    case enum_mask(se64bsbsfi64b, be, sig, i):    return template_decode_batch<se64bsbsfi64b, be, sig, i>;
+    case enum_mask(se64bsbsfi64b, be, sig, f):    return template_decode_batch<se64bsbsfi64b, be, sig, f>;
+    case enum_mask(se64bsbsfi64b, be, sig, d):    return template_decode_batch<se64bsbsfi64b, be, sig, d>;
+    case enum_mask(se64bsbsfi64b, be, usig, i):   return template_decode_batch<se64bsbsfi64b, be, usig, i>;
+    case enum_mask(se64bsbsfi64b, be, usig, f):   return template_decode_batch<se64bsbsfi64b, be, usig, f>;
+    case enum_mask(se64bsbsfi64b, be, usig, d):   return template_decode_batch<se64bsbsfi64b, be, usig, d>;
+    case enum_mask(se64bsasdnfi64b, le, sig, i):  return template_decode_batch<se64bsasdnfi64b, le, sig, i>;
+    case enum_mask(se64bsasdnfi64b, le, sig, f):  return template_decode_batch<se64bsasdnfi64b, le, sig, f>;
+    case enum_mask(se64bsasdnfi64b, le, sig, d):  return template_decode_batch<se64bsasdnfi64b, le, sig, d>;
+    case enum_mask(se64bsasdnfi64b, le, usig, i): return template_decode_batch<se64bsasdnfi64b, le, usig, i>;
+    case enum_mask(se64bsasdnfi64b, le, usig, f): return template_decode_batch<se64bsasdnfi64b, le, usig, f>;
+    case enum_mask(se64bsasdnfi64b, le, usig, d): return template_decode_batch<se64bsasdnfi64b, le, usig, d>;
+    case enum_mask(se64bsasdnfi64b, be, sig, i):  return template_decode_batch<se64bsasdnfi64b, be, sig, i>;
+    case enum_mask(se64bsasdnfi64b, be, sig, f):  return template_decode_batch<se64bsasdnfi64b, be, sig, f>;
+    case enum_mask(se64bsasdnfi64b, be, sig, d):  return template_decode_batch<se64bsasdnfi64b, be, sig, d>;
+    case enum_mask(se64bsasdnfi64b, be, usig, i): return template_decode_batch<se64bsasdnfi64b, be, usig, i>;
+    case enum_mask(se64bsasdnfi64b, be, usig, f): return template_decode_batch<se64bsasdnfi64b, be, usig, f>;
+    case enum_mask(se64bsasdnfi64b, be, usig, d): return template_decode_batch<se64bsasdnfi64b, be, usig, d>;
+    }
+    return nullptr;
+}
+using decode_descriptor_func_t = ISignal::raw_t (*)(const ISignal::Descriptor*, const void*) noexcept;
+decode_descriptor_func_t make_decode_descriptor(Alignment a, ISignal::EByteOrder bo, ISignal::EValueType vt, ISignal::EExtendedValueType evt)
+{
+    constexpr auto si64b            = Alignment::size_inbetween_first_64_bit;
+    constexpr auto se64bsbsfi64b    = Alignment::signal_exceeds_64_bit_size_but_signal_fits_into_64_bit;
+    constexpr auto se64bsasdnfi64b  = Alignment::signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit;
+    constexpr auto le               = ISignal::EByteOrder::LittleEndian;
+    constexpr auto be               = ISignal::EByteOrder::BigEndian;
+    constexpr auto sig              = ISignal::EValueType::Signed;
+    constexpr auto usig             = ISignal::EValueType::Unsigned;
+    constexpr auto i                = ISignal::EExtendedValueType::Integer;
+    constexpr auto f                = ISignal::EExtendedValueType::Float;
+    constexpr auto d                = ISignal::EExtendedValueType::Double;
+    switch (enum_mask(a, bo, vt, evt))
+    {
+    case enum_mask(si64b, le, sig, i):            return template_decode_descriptor<si64b, le, sig, i>;
+    case enum_mask(si64b, le, sig, f):            return template_decode_descriptor<si64b, le, sig, f>;
+    case enum_mask(si64b, le, sig, d):            return template_decode_descriptor<si64b, le, sig, d>;
+    case enum_mask(si64b, le, usig, i):           return template_decode_descriptor<si64b, le, usig, i>;
+    case enum_mask(si64b, le, usig, f):           return template_decode_descriptor<si64b, le, usig, f>;
+    case enum_mask(si64b, le, usig, d):           return template_decode_descriptor<si64b, le, usig, d>;
+    case enum_mask(si64b, be, sig, i):            return template_decode_descriptor<si64b, be, sig, i>;
+    case enum_mask(si64b, be, sig, f):            return template_decode_descriptor<si64b, be, sig, f>;
+    case enum_mask(si64b, be, sig, d):            return template_decode_descriptor<si64b, be, sig, d>;
+    case enum_mask(si64b, be, usig, i):           return template_decode_descriptor<si64b, be, usig, i>;
+    case enum_mask(si64b, be, usig, f):           return template_decode_descriptor<si64b, be, usig, f>;
+    case enum_mask(si64b, be, usig, d):           return template_decode_descriptor<si64b, be, usig, d>;
+    case enum_mask(se64bsbsfi64b, le, sig, i):    return template_decode_descriptor<se64bsbsfi64b, le, sig, i>;
+    case enum_mask(se64bsbsfi64b, le, sig, f):    return template_decode_descriptor<se64bsbsfi64b, le, sig, f>;
+    case enum_mask(se64bsbsfi64b, le, sig, d):    return template_decode_descriptor<se64bsbsfi64b, le, sig, d>;
+    case enum_mask(se64bsbsfi64b, le, usig, i):   return template_decode_descriptor<se64bsbsfi64b, le, usig, i>;
+    case enum_mask(se64bsbsfi64b, le, usig, f):   return template_decode_descriptor<se64bsbsfi64b, le, usig, f>;
+    case enum_mask(se64bsbsfi64b, le, usig, d):   return template_decode_descriptor<se64bsbsfi64b, le, usig, d>;
+    case enum_mask(se64bsbsfi64b, be, sig, i):    return template_decode_descriptor<se64bsbsfi64b, be, sig, i>;
+    case enum_mask(se64bsbsfi64b, be, sig, f):    return template_decode_descriptor<se64bsbsfi64b, be, sig, f>;
+    case enum_mask(se64bsbsfi64b, be, sig, d):    return template_decode_descriptor<se64bsbsfi64b, be, sig, d>;
+    case enum_mask(se64bsbsfi64b, be, usig, i):   return template_decode_descriptor<se64bsbsfi64b, be, usig, i>;
+    case enum_mask(se64bsbsfi64b, be, usig, f):   return template_decode_descriptor<se64bsbsfi64b, be, usig, f>;
+    case enum_mask(se64bsbsfi64b, be, usig, d):   return template_decode_descriptor<se64bsbsfi64b, be, usig, d>;
+    case enum_mask(se64bsasdnfi64b, le, sig, i):  return template_decode_descriptor<se64bsasdnfi64b, le, sig, i>;
+    case enum_mask(se64bsasdnfi64b, le, sig, f):  return template_decode_descriptor<se64bsasdnfi64b, le, sig, f>;
+    case enum_mask(se64bsasdnfi64b, le, sig, d):  return template_decode_descriptor<se64bsasdnfi64b, le, sig, d>;
+    case enum_mask(se64bsasdnfi64b, le, usig, i): return template_decode_descriptor<se64bsasdnfi64b, le, usig, i>;
+    case enum_mask(se64bsasdnfi64b, le, usig, f): return template_decode_descriptor<se64bsasdnfi64b, le, usig, f>;
+    case enum_mask(se64bsasdnfi64b, le, usig, d): return template_decode_descriptor<se64bsasdnfi64b, le, usig, d>;
+    case enum_mask(se64bsasdnfi64b, be, sig, i):  return template_decode_descriptor<se64bsasdnfi64b, be, sig, i>;
+    case enum_mask(se64bsasdnfi64b, be, sig, f):  return template_decode_descriptor<se64bsasdnfi64b, be, sig, f>;
+    case enum_mask(se64bsasdnfi64b, be, sig, d):  return template_decode_descriptor<se64bsasdnfi64b, be, sig, d>;
+    case enum_mask(se64bsasdnfi64b, be, usig, i): return template_decode_descriptor<se64bsasdnfi64b, be, usig, i>;
+    case enum_mask(se64bsasdnfi64b, be, usig, f): return template_decode_descriptor<se64bsasdnfi64b, be, usig, f>;
+    case enum_mask(se64bsasdnfi64b, be, usig, d): return template_decode_descriptor<se64bsasdnfi64b, be, usig, d>;
+    }
+    return nullptr;
+}
 decode_func_t make_decodeMuxSignal(Alignment a, ISignal::EByteOrder bo, ISignal::EValueType vt, ISignal::EExtendedValueType evt)
 {
     constexpr auto si64b            = Alignment::size_inbetween_first_64_bit;
@@ -208,54 +425,103 @@ decode_func_t make_decodeMuxSignal(Alignment a, ISignal::EByteOrder bo, ISignal:
     }
     return nullptr;
 }
-void encode(const ISignal* sig, ISignal::raw_t raw, void* buffer) noexcept
+template <Alignment aAlignment, ISignal::EByteOrder aByteOrder>
+void template_encode(const ISignal* sig, ISignal::raw_t raw, void* buffer) noexcept
 {
     const SignalImpl* sigi = static_cast<const SignalImpl*>(sig);
-    char* b = reinterpret_cast<char*>(buffer);
-    if (sigi->ByteOrder() == ISignal::EByteOrder::BigEndian)
+    uint8_t* b = reinterpret_cast<uint8_t*>(buffer);
+    uint64_t* word;
+    if constexpr (aAlignment == Alignment::size_inbetween_first_64_bit)
+    {
+        word = reinterpret_cast<uint64_t*>(b);
+    }
+    else
     {
-        uint64_t src = sigi->StartBit();
-        uint64_t dst = sigi->BitSize() - 1;
-        for (uint64_t i = 0; i < sigi->BitSize(); i++)
+        word = reinterpret_cast<uint64_t*>(&b[sigi->_encode_byte_pos]);
+    }
+    uint64_t data = *word;
+    if constexpr (aByteOrder == ISignal::EByteOrder::BigEndian)
+    {
+        native_to_big_inplace(data);
+    }
+    else
+    {
+        native_to_little_inplace(data);
+    }
+    uint64_t value;
+    if constexpr (aAlignment == Alignment::signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit)
+    {
+        // the signal spans 9 bytes, the first one lies in front of the word
+        uint64_t first;
+        if constexpr (aByteOrder == ISignal::EByteOrder::BigEndian)
         {
-            if (raw & (1ull << dst))
-            {
-                b[src / 8] |= 1ull << (src % 8);
-            }
-            else
-            {
-                b[src / 8] &= ~(1ull << (src % 8));
-            }
-            if ((src % 8) == 0)
-            {
-                src += 15;
-            }
-            else
-            {
-                src--;
-            }
-            dst--;
+            first = raw >> sigi->_encode_shift_1;
+            value = raw << sigi->_encode_shift_0;
+        }
+        else
+        {
+            first = raw << sigi->_encode_shift_1;
+            value = raw >> sigi->_encode_shift_0;
         }
+        uint8_t& byte = b[sigi->_encode_byte_pos - 1];
+        byte = uint8_t((byte & ~sigi->_encode_byte_mask) | (first & sigi->_encode_byte_mask));
     }
     else
     {
-        uint64_t src = sigi->StartBit();
-        uint64_t dst = 0;
-        for (uint64_t i = 0; i < sigi->BitSize(); i++)
+        value = raw << sigi->_encode_shift_0;
+    }
+    data = (data & ~sigi->_encode_mask) | (value & sigi->_encode_mask);
+    if constexpr (aByteOrder == ISignal::EByteOrder::BigEndian)
+    {
+        native_to_big_inplace(data);
+    }
+    else
+    {
+        native_to_little_inplace(data);
+    }
+    *word = data;
+}
+template <ISignal::EByteOrder aByteOrder>
+void template_encode_short_frame(const ISignal* sig, ISignal::raw_t raw, void* buffer) noexcept
+{
+    // frames shorter than 8 bytes may live in buffers shorter than the word, so only the bytes
+    // of the signal are read and written
+    const SignalImpl* sigi = static_cast<const SignalImpl*>(sig);
+    uint8_t* b = reinterpret_cast<uint8_t*>(buffer);
+    uint64_t value = raw << sigi->_encode_shift_0;
+    for (std::size_t i = 0; i < 8; i++)
+    {
+        std::size_t shift = aByteOrder == ISignal::EByteOrder::BigEndian ? 56 - 8 * i : 8 * i;
+        uint8_t mask = uint8_t(sigi->_encode_mask >> shift);
+        if (mask)
         {
-            if (raw & (1ull << dst))
-            {
-                b[src / 8] |= 1ull << (src % 8);
-            }
-            else
-            {
-                b[src / 8] &= ~(1ull << (src % 8));
-            }
-            src++;
-            dst++;
+            b[i] = uint8_t((b[i] & ~mask) | ((value >> shift) & mask));
         }
     }
 }
+using encode_func_t = void (*)(const ISignal*, ISignal::raw_t, void*) noexcept;
+encode_func_t make_encode(Alignment a, ISignal::EByteOrder bo)
+{
+    constexpr auto si64b            = Alignment::size_inbetween_first_64_bit;
+    constexpr auto se64bsbsfi64b    = Alignment::signal_exceeds_64_bit_size_but_signal_fits_into_64_bit;
+    constexpr auto se64bsasdnfi64b  = Alignment::signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit;
+    constexpr auto le               = ISignal::EByteOrder::LittleEndian;
+    constexpr auto be               = ISignal::EByteOrder::BigEndian;
+    // the value and extended value type don't matter for encoding, the raw bits are written as they are
+    switch (a)
+    {
+    case si64b:           return bo == le ? template_encode<si64b, le> : template_encode<si64b, be>;
+    case se64bsbsfi64b:   return bo == le ? template_encode<se64bsbsfi64b, le> : template_encode<se64bsbsfi64b, be>;
+    case se64bsasdnfi64b: return bo == le ? template_encode<se64bsasdnfi64b, le> : template_encode<se64bsasdnfi64b, be>;
+    }
+    return nullptr;
+}
+encode_func_t make_encode_short_frame(ISignal::EByteOrder bo)
+{
+    return bo == ISignal::EByteOrder::LittleEndian
+        ? template_encode_short_frame<ISignal::EByteOrder::LittleEndian>
+        : template_encode_short_frame<ISignal::EByteOrder::BigEndian>;
+}
 template <class T>
 double raw_to_phys(const ISignal* sig, ISignal::raw_t raw) noexcept
 {
@@ -264,11 +530,159 @@ double raw_to_phys(const ISignal* sig, ISignal::raw_t raw) noexcept
     return draw * sigi->Factor() + sigi->Offset();
 }
 template <class T>
+double raw_to_phys_identity(const ISignal*, ISignal::raw_t raw) noexcept
+{
+    T value;
+    std::memcpy(&value, &raw, sizeof(value));
+    return double(value);
+}
+template <class T>
 ISignal::raw_t phys_to_raw(const ISignal* sig, double phys) noexcept
 {
     const SignalImpl* sigi = static_cast<const SignalImpl*>(sig);
-    T result = T((phys - sigi->Offset()) / sigi->Factor());
-    return *reinterpret_cast<ISignal::raw_t*>(&result);
+    T result = phys_to_raw_cast<T>((phys - sigi->Offset()) / sigi->Factor());
+    // float only fills the lower 32 bit
+    ISignal::raw_t raw = 0;
+    std::memcpy(&raw, &result, sizeof(result));
+    return raw;
+}
+template <class T>
+ISignal::raw_t phys_to_raw_identity(const ISignal*, double phys) noexcept
+{
+    T result = phys_to_raw_cast<T>(phys);
+    ISignal::raw_t raw = 0;
+    std::memcpy(&raw, &result, sizeof(result));
+    return raw;
+}
+template <class T>
+void raw_to_phys_batch(const ISignal* sig, const ISignal::raw_t* raw, double* phys, std::size_t n) noexcept
+{
+    const SignalImpl* sigi = static_cast<const SignalImpl*>(sig);
+    const double factor = sigi->Factor();
+    const double offset = sigi->Offset();
+    for (std::size_t i = 0; i < n; i++)
+    {
+        T value;
+        std::memcpy(&value, &raw[i], sizeof(value));
+        phys[i] = double(value) * factor + offset;
+    }
+}
+template <class T>
+void raw_to_phys_batch_identity(const ISignal*, const ISignal::raw_t* raw, double* phys, std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; i++)
+    {
+        T value;
+        std::memcpy(&value, &raw[i], sizeof(value));
+        phys[i] = double(value);
+    }
+}
+template <class T>
+void phys_to_raw_batch(const ISignal* sig, const double* phys, ISignal::raw_t* raw, std::size_t n) noexcept
+{
+    const SignalImpl* sigi = static_cast<const SignalImpl*>(sig);
+    const double factor = sigi->Factor();
+    const double offset = sigi->Offset();
+    for (std::size_t i = 0; i < n; i++)
+    {
+        T result = phys_to_raw_cast<T>((phys[i] - offset) / factor);
+        ISignal::raw_t r = 0;
+        std::memcpy(&r, &result, sizeof(result));
+        raw[i] = r;
+    }
+}
+template <class T>
+void phys_to_raw_batch_identity(const ISignal*, const double* phys, ISignal::raw_t* raw, std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; i++)
+    {
+        T result = phys_to_raw_cast<T>(phys[i]);
+        ISignal::raw_t r = 0;
+        std::memcpy(&r, &result, sizeof(result));
+        raw[i] = r;
+    }
+}
+double raw_to_phys_lut(const ISignal* sig, ISignal::raw_t raw) noexcept
+{
+    const SignalImpl* sigi = static_cast<const SignalImpl*>(sig);
+    return sigi->_lut_data[raw & sigi->_lut_mask];
+}
+void raw_to_phys_batch_lut(const ISignal* sig, const ISignal::raw_t* raw, double* phys, std::size_t n) noexcept
+{
+    const SignalImpl* sigi = static_cast<const SignalImpl*>(sig);
+    const double* lut = sigi->_lut_data;
+    const uint64_t mask = sigi->_lut_mask;
+    for (std::size_t i = 0; i < n; i++)
+    {
+        phys[i] = lut[raw[i] & mask];
+    }
+}
+namespace
+{
+    // larger tables don't fit into the caches anymore and are slower than the conversion
+    constexpr uint64_t lut_max_bit_size = 16;
+
+    struct LUTConfig
+    {
+        std::atomic<uint64_t> max_bit_size{0};
+        std::atomic<std::size_t> memory_budget{0};
+        std::atomic<std::size_t> memory{0};
+    };
+    LUTConfig& lut_config() noexcept
+    {
+        static LUTConfig config;
+        return config;
+    }
+    // returns nullptr if the signal is too wide or the table doesn't fit into the memory budget
+    std::shared_ptr<const std::vector<double>> make_raw_to_phys_lut(const SignalImpl& sig, double (*raw_to_phys)(const ISignal*, ISignal::raw_t) noexcept)
+    {
+        LUTConfig& config = lut_config();
+        const uint64_t bit_size = sig.BitSize();
+        if (bit_size == 0 || bit_size > config.max_bit_size.load(std::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+        const std::size_t size = std::size_t(1) << bit_size;
+        const std::size_t bytes = size * sizeof(double);
+        const std::size_t budget = config.memory_budget.load(std::memory_order_relaxed);
+        std::size_t memory = config.memory.load(std::memory_order_relaxed);
+        do
+        {
+            if (memory + bytes > budget)
+            {
+                return nullptr;
+            }
+        } while (!config.memory.compare_exchange_weak(memory, memory + bytes, std::memory_order_relaxed));
+        // copies of the signal share the table, the budget is given back when the last one is gone
+        std::shared_ptr<std::vector<double>> lut(new std::vector<double>(size),
+            [bytes](std::vector<double>* lut)
+            {
+                delete lut;
+                lut_config().memory.fetch_sub(bytes, std::memory_order_relaxed);
+            });
+        const uint64_t sign_bit = 1ull << (bit_size - 1);
+        for (uint64_t i = 0; i < size; i++)
+        {
+            ISignal::raw_t raw = i;
+            if (sig.ValueType() == ISignal::EValueType::Signed)
+            {
+                raw = (i ^ sign_bit) - sign_bit;
+            }
+            // computed with the conversion it replaces, so the results are bit identical
+            (*lut)[i] = raw_to_phys(&sig, raw);
+        }
+        return lut;
+    }
+}
+void ISignal::SetRawToPhysLUT(uint64_t max_bit_size, std::size_t memory_budget) noexcept
+{
+    LUTConfig& config = lut_config();
+    config.max_bit_size.store(std::min(max_bit_size, lut_max_bit_size), std::memory_order_relaxed);
+    config.memory_budget.store(memory_budget, std::memory_order_relaxed);
+}
+std::size_t ISignal::RawToPhysLUTMemory() noexcept
+{
+    return lut_config().memory.load(std::memory_order_relaxed);
 }
 std::unique_ptr<ISignal> ISignal::Create(
       uint64_t message_size
@@ -369,11 +783,15 @@ SignalImpl::SignalImpl(
     , _receivers(std::move(receivers))
     , _attribute_values(std::move(attribute_values))
     , _value_encoding_descriptions(std::move(value_encoding_descriptions))
+    , _value_encoding_index(_value_encoding_descriptions)
     , _comment(std::move(comment))
     , _extended_value_type(std::move(extended_value_type))
     , _signal_multiplexer_values(std::move(signal_multiplexer_values))
+    , _lut_data(nullptr)
+    , _lut_mask(0)
     , _error(EErrorCode::NoError)
 {
+    bool short_frame = message_size < 8;
     message_size = message_size < 8 ? 8 : message_size;
     // check for out of frame size error
     switch (byte_order)
@@ -432,6 +850,47 @@ SignalImpl::SignalImpl(
     {
         nbytes = (_bit_size + (7 - _start_bit % 8) + 7) / 8;
     }
+
+    // encode works on the 8 byte word ending with the last byte of the signal, so for frames of
+    // at least 8 bytes it never touches bytes behind the frame
+    uint64_t last_byte = _byte_pos + nbytes - 1;
+    _encode_byte_pos = last_byte < 8 ? 0 : last_byte - 7;
+    _encode_shift_1 = 0;
+    _encode_byte_mask = 0;
+    if (nbytes <= 8)
+    {
+        if (_byte_order == EByteOrder::LittleEndian)
+        {
+            _encode_shift_0 = _start_bit - _encode_byte_pos * 8;
+        }
+        else
+        {
+            uint64_t msb = 8 * (7 - (_byte_pos - _encode_byte_pos)) + _start_bit % 8;
+            _encode_shift_0 = msb - (_bit_size - 1);
+        }
+        _encode_mask = _mask << _encode_shift_0;
+    }
+    else
+    {
+        // the first byte of the signal lies in front of the word
+        if (_byte_order == EByteOrder::LittleEndian)
+        {
+            uint64_t nbits_first_byte = 8 - _start_bit % 8;
+            _encode_shift_0 = nbits_first_byte;
+            _encode_shift_1 = _start_bit % 8;
+            _encode_mask = _mask >> _encode_shift_0;
+            _encode_byte_mask = (_mask << _encode_shift_1) & 0xFF;
+        }
+        else
+        {
+            uint64_t nbits_word = _bit_size - (_start_bit % 8 + 1);
+            _encode_shift_0 = 64 - nbits_word;
+            _encode_shift_1 = nbits_word;
+            _encode_mask = _mask << _encode_shift_0;
+            _encode_byte_mask = (_mask >> _encode_shift_1) & 0xFF;
+        }
+    }
+
     Alignment alignment = Alignment::size_inbetween_first_64_bit;
     // check whether the data is in the first 8 bytes
     // so we can optimize out one memory access
@@ -490,32 +949,92 @@ SignalImpl::SignalImpl(
         }
     }
 
+    _alignment = alignment;
     _decode = ::make_decode(alignment, _byte_order, _value_type, _extended_value_type);
-    _encode = ::encode;
+    _decode_partial = ::make_decode_partial(alignment, _byte_order, _value_type, _extended_value_type);
+    switch (alignment)
+    {
+    case Alignment::size_inbetween_first_64_bit:                                    _decode_size = 8; break;
+    case Alignment::signal_exceeds_64_bit_size_but_signal_fits_into_64_bit:         _decode_size = _byte_pos + 8; break;
+    case Alignment::signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit: _decode_size = _byte_pos + 9; break;
+    }
+    _decode_batch = ::make_decode_batch(alignment, _byte_order, _value_type, _extended_value_type);
+    _simd_decode_batch = make_simd_decode_batch(ISignal::SIMDLevel(), alignment, _byte_order, _value_type, _extended_value_type);
+    _encode = short_frame ? ::make_encode_short_frame(_byte_order) : ::make_encode(alignment, _byte_order);
+    // factor 1 and offset 0 is common enough (e.g. for enums and counters) to skip the scaling
+    bool identity = _factor == 1. && _offset == 0.;
+    auto set_conversions =
+        [&](auto type)
+        {
+            using T = decltype(type);
+            if (identity)
+            {
+                _raw_to_phys = ::raw_to_phys_identity<T>;
+                _phys_to_raw = ::phys_to_raw_identity<T>;
+                _raw_to_phys_batch = ::raw_to_phys_batch_identity<T>;
+                _phys_to_raw_batch = ::phys_to_raw_batch_identity<T>;
+            }
+            else
+            {
+                _raw_to_phys = ::raw_to_phys<T>;
+                _phys_to_raw = ::phys_to_raw<T>;
+                _raw_to_phys_batch = ::raw_to_phys_batch<T>;
+                _phys_to_raw_batch = ::phys_to_raw_batch<T>;
+            }
+        };
     switch (_extended_value_type)
     {
     case EExtendedValueType::Integer:
         switch (_value_type)
         {
         case EValueType::Signed:
-            _raw_to_phys = ::raw_to_phys<int64_t>;
-            _phys_to_raw = ::phys_to_raw<int64_t>;
+            set_conversions(int64_t());
             break;
         case EValueType::Unsigned:
-            _raw_to_phys = ::raw_to_phys<uint64_t>;
-            _phys_to_raw = ::phys_to_raw<uint64_t>;
+            set_conversions(uint64_t());
             break;
         }
         break;
     case EExtendedValueType::Float:
-        _raw_to_phys = ::raw_to_phys<float>;
-        _phys_to_raw = ::phys_to_raw<float>;
+        set_conversions(float());
         break;
     case EExtendedValueType::Double:
-        _raw_to_phys = ::raw_to_phys<double>;
-        _phys_to_raw = ::phys_to_raw<double>;
+        set_conversions(double());
         break;
     }
+    // narrow scaled integers (flags, enums, counters): one load from a table instead of a conversion and a multiply-add
+    if (_extended_value_type == EExtendedValueType::Integer && !identity && Error(EErrorCode::NoError))
+    {
+        _lut = make_raw_to_phys_lut(*this, _raw_to_phys);
+    }
+    if (_lut)
+    {
+        _lut_data = _lut->data();
+        _lut_mask = _lut->size() - 1;
+        _raw_to_phys = ::raw_to_phys_lut;
+        _raw_to_phys_batch = ::raw_to_phys_batch_lut;
+    }
+    // the vectorized conversion keeps up with the table lookups, so it's preferred for the batches
+    if (auto raw_to_phys_batch = make_simd_raw_to_phys_batch(ISignal::SIMDLevel(), _value_type, _extended_value_type, identity))
+    {
+        _raw_to_phys_batch = raw_to_phys_batch;
+    }
+    if (auto phys_to_raw_batch = make_simd_phys_to_raw_batch(ISignal::SIMDLevel(), _value_type, _extended_value_type, identity))
+    {
+        _phys_to_raw_batch = phys_to_raw_batch;
+    }
+}
+ISignal::Descriptor SignalImpl::descriptor() const
+{
+    Descriptor desc;
+    desc.decode = ::make_decode_descriptor(_alignment, _byte_order, _value_type, _extended_value_type);
+    desc.mask = _mask;
+    desc.mask_signed = _mask_signed;
+    desc.byte_pos = uint32_t(_byte_pos);
+    desc.fixed_start_bit_0 = uint8_t(_fixed_start_bit_0);
+    desc.fixed_start_bit_1 = uint8_t(_fixed_start_bit_1);
+    desc.decode_size = uint16_t(_decode_size);
+    return desc;
 }
 std::unique_ptr<ISignal> SignalImpl::Clone() const
 {
@@ -585,6 +1104,14 @@ uint64_t SignalImpl::ValueEncodingDescriptions_Size() const
 {
     return _value_encoding_descriptions.size();
 }
+std::optional<std::string_view> SignalImpl::ValueToDescription(int64_t value) const
+{
+    return _value_encoding_index.find(_value_encoding_descriptions, value);
+}
+std::optional<int64_t> SignalImpl::DescriptionToValue(std::string_view description) const
+{
+    return _value_encoding_index.find(_value_encoding_descriptions, description);
+}
 const IAttribute& SignalImpl::AttributeValues_Get(std::size_t i) const
 {
     return _attribute_values[i];
@@ -2,15 +2,52 @@
 
 #include <string>
 #include <memory>
+#include <vector>
+#include <limits>
+#include <type_traits>
 
 #include <dbcppp/Signal.h>
 #include <dbcppp/Node.h>
 #include "AttributeImpl.h"
 #include "SignalMultiplexerValueImpl.h"
 #include "ValueEncodingDescriptionImpl.h"
+#include "ValueEncodingIndex.h"
 
 namespace dbcppp
 {
+    // Converts a physical value to the raw type T. C++ leaves the conversion of values out of the range of an
+    // integer type undefined, so it's defined here and the vectorized PhysToRawBatch kernels do the same:
+    // negative values are converted to uint64_t through int64_t (they wrap around), NaN and values beyond the
+    // range of the type become INT64_MIN for int64_t and UINT64_MAX for uint64_t.
+    template <class T>
+    inline T phys_to_raw_cast(double value) noexcept
+    {
+        if constexpr (std::is_same_v<T, int64_t>)
+        {
+            return value >= -9223372036854775808.0 && value < 9223372036854775808.0
+                ? int64_t(value) : std::numeric_limits<int64_t>::min();
+        }
+        else if constexpr (std::is_same_v<T, uint64_t>)
+        {
+            if (value < 0.0)
+            {
+                return uint64_t(phys_to_raw_cast<int64_t>(value));
+            }
+            return value < 18446744073709551616.0 ? uint64_t(value) : std::numeric_limits<uint64_t>::max();
+        }
+        else
+        {
+            return T(value);
+        }
+    }
+
+    enum class Alignment
+    {
+        size_inbetween_first_64_bit,
+        signal_exceeds_64_bit_size_but_signal_fits_into_64_bit,
+        signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit
+    };
+
     class SignalImpl final
         : public ISignal
     {
@@ -54,6 +91,8 @@ namespace dbcppp
         virtual uint64_t Receivers_Size() const override;
         virtual const IValueEncodingDescription& ValueEncodingDescriptions_Get(std::size_t i) const override;
         virtual uint64_t ValueEncodingDescriptions_Size() const override;
+        virtual std::optional<std::string_view> ValueToDescription(int64_t value) const override;
+        virtual std::optional<int64_t> DescriptionToValue(std::string_view description) const override;
         virtual const IAttribute& AttributeValues_Get(std::size_t i) const override;
         virtual uint64_t AttributeValues_Size() const override;
         virtual const std::string& Comment() const override;
@@ -61,6 +100,8 @@ namespace dbcppp
         virtual const ISignalMultiplexerValue& SignalMultiplexerValues_Get(std::size_t i) const override;
         virtual uint64_t SignalMultiplexerValues_Size() const override;
         virtual bool Error(EErrorCode code) const override;
+
+        Descriptor descriptor() const;
         
         virtual bool operator==(const ISignal& rhs) const override;
         virtual bool operator!=(const ISignal& rhs) const override;
@@ -83,18 +124,37 @@ namespace dbcppp
         std::vector<std::string> _receivers;
         std::vector<AttributeImpl> _attribute_values;
         std::vector<ValueEncodingDescriptionImpl> _value_encoding_descriptions;
+        ValueEncodingIndex _value_encoding_index;
         std::string _comment;
         EExtendedValueType _extended_value_type;
         std::vector<SignalMultiplexerValueImpl> _signal_multiplexer_values;
 
     public:
         // for performance
+        Alignment _alignment;
         uint64_t _mask;
         uint64_t _mask_signed;
         uint64_t _fixed_start_bit_0;
         uint64_t _fixed_start_bit_1;
         uint64_t _byte_pos;
 
+        uint64_t _encode_mask;
+        uint64_t _encode_byte_mask;
+        uint64_t _encode_shift_0;
+        uint64_t _encode_shift_1;
+        uint64_t _encode_byte_pos;
+
+        // RawToPhys lookup table indexed with the lower _lut_mask bits of the raw value, nullptr if not used
+        std::shared_ptr<const std::vector<double>> _lut;
+        const double* _lut_data;
+        uint64_t _lut_mask;
+
+        // vectorized part of DecodeBatch, returns the number of frames it decoded
+        std::size_t (*_simd_decode_batch)(const SignalImpl* sig, const uint8_t* frames, std::size_t stride, std::size_t count, raw_t* values) noexcept;
+
         EErrorCode _error;
+
+        // index of the owning message in NetworkImpl::_messages, set by the network
+        uint32_t _message_index = uint32_t(-1);
     };
 }
\ No newline at end of file
@@ -0,0 +1,630 @@
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+#include "SignalSIMD.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#   define DBCPPP_X86_SIMD
+#   include <immintrin.h>
+#   define DBCPPP_TARGET(isa) __attribute__((target(isa)))
+    // keeps the compiler from contracting a multiply and a following add into a FMA, the scaling
+    // has to round exactly like the scalar RawToPhys does
+#   define DBCPPP_NO_CONTRACT(v) asm("" : "+v"(v))
+#endif
+
+using namespace dbcppp;
+
+namespace
+{
+    ISignal::ESIMDLevel detect_simd_level() noexcept
+    {
+#ifdef DBCPPP_X86_SIMD
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512dq"))
+        {
+            return ISignal::ESIMDLevel::AVX512;
+        }
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return ISignal::ESIMDLevel::AVX2;
+        }
+        if (__builtin_cpu_supports("sse4.2"))
+        {
+            return ISignal::ESIMDLevel::SSE42;
+        }
+#endif
+        return ISignal::ESIMDLevel::None;
+    }
+    std::atomic<ISignal::ESIMDLevel>& simd_level() noexcept
+    {
+        static std::atomic<ISignal::ESIMDLevel> level{ISignal::SupportedSIMDLevel()};
+        return level;
+    }
+}
+
+ISignal::ESIMDLevel ISignal::SupportedSIMDLevel() noexcept
+{
+    static const ESIMDLevel supported = detect_simd_level();
+    return supported;
+}
+ISignal::ESIMDLevel ISignal::SIMDLevel() noexcept
+{
+    return simd_level().load(std::memory_order_relaxed);
+}
+void ISignal::SetSIMDLevel(ESIMDLevel level) noexcept
+{
+    if (level > SupportedSIMDLevel())
+    {
+        level = SupportedSIMDLevel();
+    }
+    simd_level().store(level, std::memory_order_relaxed);
+}
+
+#ifdef DBCPPP_X86_SIMD
+
+// The kernels below are the vectorized counterparts of decode_frame in SignalImpl.cpp. Each lane
+// decodes the signal from one frame, the frames are fetched with one (gather) load per lane, so
+// the stride between two frames can be arbitrary.
+
+namespace
+{
+    constexpr bool straddles(Alignment a)
+    {
+        return a == Alignment::signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit;
+    }
+    inline uint64_t load_u64(const uint8_t* bytes) noexcept
+    {
+        uint64_t result;
+        std::memcpy(&result, bytes, sizeof(result));
+        return result;
+    }
+
+    // SSE4.2: 2 lanes
+
+    DBCPPP_TARGET("sse4.2") inline __m128i sse42_sign_extend(__m128i data, __m128i mask_signed) noexcept
+    {
+        __m128i positive = _mm_cmpeq_epi64(_mm_and_si128(data, mask_signed), _mm_setzero_si128());
+        return _mm_or_si128(data, _mm_andnot_si128(positive, mask_signed));
+    }
+    template <Alignment aAlignment, ISignal::EByteOrder aByteOrder, ISignal::EValueType aValueType, ISignal::EExtendedValueType aExtendedValueType>
+    DBCPPP_TARGET("sse4.2") std::size_t sse42_decode_batch(const SignalImpl* sigi, const uint8_t* frames, std::size_t stride, std::size_t count, ISignal::raw_t* values) noexcept
+    {
+        const uint64_t byte_pos = aAlignment == Alignment::size_inbetween_first_64_bit ? 0 : sigi->_byte_pos;
+        const __m128i bswap = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+        const __m128i mask = _mm_set1_epi64x(sigi->_mask);
+        const __m128i mask_signed = _mm_set1_epi64x(sigi->_mask_signed);
+        const __m128i shift0 = _mm_cvtsi64_si128(sigi->_fixed_start_bit_0);
+        const __m128i shift1 = _mm_cvtsi64_si128(sigi->_fixed_start_bit_1);
+        std::size_t i = 0;
+        for (; i + 2 <= count; i += 2, frames += 2 * stride)
+        {
+            const uint8_t* f0 = frames + byte_pos;
+            const uint8_t* f1 = frames + stride + byte_pos;
+            __m128i data = _mm_set_epi64x(load_u64(f1), load_u64(f0));
+            if constexpr (aByteOrder == ISignal::EByteOrder::BigEndian)
+            {
+                data = _mm_shuffle_epi8(data, bswap);
+            }
+            if constexpr (straddles(aAlignment))
+            {
+                __m128i data1 = _mm_set_epi64x(f1[8], f0[8]);
+                if constexpr (aByteOrder == ISignal::EByteOrder::BigEndian)
+                {
+                    data = _mm_sll_epi64(_mm_and_si128(data, mask), shift0);
+                    data = _mm_or_si128(data, _mm_srl_epi64(data1, shift1));
+                }
+                else
+                {
+                    data = _mm_srl_epi64(data, shift0);
+                    data = _mm_or_si128(data, _mm_sll_epi64(_mm_and_si128(data1, mask), shift1));
+                }
+                if constexpr (aExtendedValueType == ISignal::EExtendedValueType::Integer && aValueType == ISignal::EValueType::Signed)
+                {
+                    data = sse42_sign_extend(data, mask_signed);
+                }
+            }
+            else if constexpr (aExtendedValueType != ISignal::EExtendedValueType::Double)
+            {
+                data = _mm_and_si128(_mm_srl_epi64(data, shift0), mask);
+                if constexpr (aExtendedValueType == ISignal::EExtendedValueType::Integer && aValueType == ISignal::EValueType::Signed)
+                {
+                    data = sse42_sign_extend(data, mask_signed);
+                }
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(values + i), data);
+        }
+        return i;
+    }
+
+    // AVX2: 4 lanes
+
+    DBCPPP_TARGET("avx2") inline __m256i avx2_sign_extend(__m256i data, __m256i mask_signed) noexcept
+    {
+        __m256i positive = _mm256_cmpeq_epi64(_mm256_and_si256(data, mask_signed), _mm256_setzero_si256());
+        return _mm256_or_si256(data, _mm256_andnot_si256(positive, mask_signed));
+    }
+    template <Alignment aAlignment, ISignal::EByteOrder aByteOrder, ISignal::EValueType aValueType, ISignal::EExtendedValueType aExtendedValueType>
+    DBCPPP_TARGET("avx2") std::size_t avx2_decode_batch(const SignalImpl* sigi, const uint8_t* frames, std::size_t stride, std::size_t count, ISignal::raw_t* values) noexcept
+    {
+        const int64_t byte_pos = aAlignment == Alignment::size_inbetween_first_64_bit ? 0 : int64_t(sigi->_byte_pos);
+        const int64_t s = int64_t(stride);
+        const __m256i index = _mm256_add_epi64(_mm256_setr_epi64x(0, s, 2 * s, 3 * s), _mm256_set1_epi64x(byte_pos));
+        const __m256i bswap = _mm256_broadcastsi128_si256(_mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+        const __m256i mask = _mm256_set1_epi64x(sigi->_mask);
+        const __m256i mask_signed = _mm256_set1_epi64x(sigi->_mask_signed);
+        const __m128i shift0 = _mm_cvtsi64_si128(sigi->_fixed_start_bit_0);
+        const __m128i shift1 = _mm_cvtsi64_si128(sigi->_fixed_start_bit_1);
+        const __m128i shift56 = _mm_cvtsi64_si128(56);
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4, frames += 4 * stride)
+        {
+            __m256i data = _mm256_i64gather_epi64(reinterpret_cast<const long long*>(frames), index, 1);
+            if constexpr (aByteOrder == ISignal::EByteOrder::BigEndian)
+            {
+                data = _mm256_shuffle_epi8(data, bswap);
+            }
+            if constexpr (straddles(aAlignment))
+            {
+                // the byte following the 64 bit word ends up in the most significant byte
+                __m256i data1 = _mm256_i64gather_epi64(reinterpret_cast<const long long*>(frames + 1), index, 1);
+                data1 = _mm256_srl_epi64(data1, shift56);
+                if constexpr (aByteOrder == ISignal::EByteOrder::BigEndian)
+                {
+                    data = _mm256_sll_epi64(_mm256_and_si256(data, mask), shift0);
+                    data = _mm256_or_si256(data, _mm256_srl_epi64(data1, shift1));
+                }
+                else
+                {
+                    data = _mm256_srl_epi64(data, shift0);
+                    data = _mm256_or_si256(data, _mm256_sll_epi64(_mm256_and_si256(data1, mask), shift1));
+                }
+                if constexpr (aExtendedValueType == ISignal::EExtendedValueType::Integer && aValueType == ISignal::EValueType::Signed)
+                {
+                    data = avx2_sign_extend(data, mask_signed);
+                }
+            }
+            else if constexpr (aExtendedValueType != ISignal::EExtendedValueType::Double)
+            {
+                data = _mm256_and_si256(_mm256_srl_epi64(data, shift0), mask);
+                if constexpr (aExtendedValueType == ISignal::EExtendedValueType::Integer && aValueType == ISignal::EValueType::Signed)
+                {
+                    data = avx2_sign_extend(data, mask_signed);
+                }
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(values + i), data);
+        }
+        return i;
+    }
+
+    // AVX-512: 8 lanes
+
+#if defined(__GNUC__) && !defined(__clang__)
+    // GCC's AVX-512 intrinsics start from _mm512_undefined_*() values and are
+    // reported as uninitialized once they are inlined
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wuninitialized"
+#   pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+    template <Alignment aAlignment, ISignal::EByteOrder aByteOrder, ISignal::EValueType aValueType, ISignal::EExtendedValueType aExtendedValueType>
+    DBCPPP_TARGET("avx512f,avx512bw,avx512dq") std::size_t avx512_decode_batch(const SignalImpl* sigi, const uint8_t* frames, std::size_t stride, std::size_t count, ISignal::raw_t* values) noexcept
+    {
+        const int64_t byte_pos = aAlignment == Alignment::size_inbetween_first_64_bit ? 0 : int64_t(sigi->_byte_pos);
+        const int64_t s = int64_t(stride);
+        const __m512i index = _mm512_add_epi64(
+              _mm512_setr_epi64(0, s, 2 * s, 3 * s, 4 * s, 5 * s, 6 * s, 7 * s)
+            , _mm512_set1_epi64(byte_pos));
+        const __m512i bswap = _mm512_broadcast_i32x4(_mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+        const __m512i mask = _mm512_set1_epi64(sigi->_mask);
+        const __m512i mask_signed = _mm512_set1_epi64(sigi->_mask_signed);
+        const __m128i shift0 = _mm_cvtsi64_si128(sigi->_fixed_start_bit_0);
+        const __m128i shift1 = _mm_cvtsi64_si128(sigi->_fixed_start_bit_1);
+        const __m128i shift56 = _mm_cvtsi64_si128(56);
+        std::size_t i = 0;
+        for (; i + 8 <= count; i += 8, frames += 8 * stride)
+        {
+            __m512i data = _mm512_i64gather_epi64(index, frames, 1);
+            if constexpr (aByteOrder == ISignal::EByteOrder::BigEndian)
+            {
+                data = _mm512_shuffle_epi8(data, bswap);
+            }
+            if constexpr (straddles(aAlignment))
+            {
+                __m512i data1 = _mm512_srl_epi64(_mm512_i64gather_epi64(index, frames + 1, 1), shift56);
+                if constexpr (aByteOrder == ISignal::EByteOrder::BigEndian)
+                {
+                    data = _mm512_sll_epi64(_mm512_and_si512(data, mask), shift0);
+                    data = _mm512_or_si512(data, _mm512_srl_epi64(data1, shift1));
+                }
+                else
+                {
+                    data = _mm512_srl_epi64(data, shift0);
+                    data = _mm512_or_si512(data, _mm512_sll_epi64(_mm512_and_si512(data1, mask), shift1));
+                }
+                if constexpr (aExtendedValueType == ISignal::EExtendedValueType::Integer && aValueType == ISignal::EValueType::Signed)
+                {
+                    data = _mm512_mask_or_epi64(data, _mm512_test_epi64_mask(data, mask_signed), data, mask_signed);
+                }
+            }
+            else if constexpr (aExtendedValueType != ISignal::EExtendedValueType::Double)
+            {
+                data = _mm512_and_si512(_mm512_srl_epi64(data, shift0), mask);
+                if constexpr (aExtendedValueType == ISignal::EExtendedValueType::Integer && aValueType == ISignal::EValueType::Signed)
+                {
+                    data = _mm512_mask_or_epi64(data, _mm512_test_epi64_mask(data, mask_signed), data, mask_signed);
+                }
+            }
+            _mm512_storeu_si512(values + i, data);
+        }
+        return i;
+    }
+#if defined(__GNUC__) && !defined(__clang__)
+#   pragma GCC diagnostic pop
+#endif
+
+    // RawToPhys/PhysToRaw over arrays, the elements not filling a whole vector are handed to the scalar
+    // function of the signal
+
+    // AVX2 has no 64 bit integer <-> double conversion, so the integer paths use the exponent trick:
+    // the integer is split into two halves which are inserted into the mantissa of two doubles with a
+    // known exponent. Subtracting the exponent part and adding the halves rounds only once, exactly
+    // like cvtsi2sd does.
+    DBCPPP_TARGET("avx2") inline __m256d avx2_u64_to_f64(__m256i x) noexcept
+    {
+        __m256i hi = _mm256_or_si256(_mm256_srli_epi64(x, 32), _mm256_castpd_si256(_mm256_set1_pd(19342813113834066795298816.)));  // 2^84
+        __m256i lo = _mm256_blend_epi16(x, _mm256_castpd_si256(_mm256_set1_pd(4503599627370496.)), 0xcc);                         // 2^52
+        __m256d f = _mm256_sub_pd(_mm256_castsi256_pd(hi), _mm256_set1_pd(19342813118337666422669312.));                           // 2^84 + 2^52
+        return _mm256_add_pd(f, _mm256_castsi256_pd(lo));
+    }
+    DBCPPP_TARGET("avx2") inline __m256d avx2_i64_to_f64(__m256i x) noexcept
+    {
+        __m256i hi = _mm256_blend_epi16(_mm256_srai_epi32(x, 16), _mm256_setzero_si256(), 0x33);
+        hi = _mm256_add_epi64(hi, _mm256_castpd_si256(_mm256_set1_pd(442721857769029238784.)));                                  // 3*2^67
+        __m256i lo = _mm256_blend_epi16(x, _mm256_castpd_si256(_mm256_set1_pd(4503599627370496.)), 0x88);                         // 2^52
+        __m256d f = _mm256_sub_pd(_mm256_castsi256_pd(hi), _mm256_set1_pd(442726361368656609280.));                               // 3*2^67 + 2^52
+        return _mm256_add_pd(f, _mm256_castsi256_pd(lo));
+    }
+    template <class T>
+    DBCPPP_TARGET("avx2") inline __m256d avx2_raw_to_double(__m256i raw) noexcept
+    {
+        if constexpr (std::is_same_v<T, int64_t>)
+        {
+            return avx2_i64_to_f64(raw);
+        }
+        else if constexpr (std::is_same_v<T, uint64_t>)
+        {
+            return avx2_u64_to_f64(raw);
+        }
+        else if constexpr (std::is_same_v<T, float>)
+        {
+            __m256i packed = _mm256_permutevar8x32_epi32(raw, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6));
+            return _mm256_cvtps_pd(_mm_castsi128_ps(_mm256_castsi256_si128(packed)));
+        }
+        else
+        {
+            return _mm256_castsi256_pd(raw);
+        }
+    }
+    template <class T, bool aIdentity>
+    DBCPPP_TARGET("avx2") void avx2_raw_to_phys_batch(const ISignal* sig, const ISignal::raw_t* raw, double* phys, std::size_t n) noexcept
+    {
+        const SignalImpl* sigi = static_cast<const SignalImpl*>(sig);
+        const __m256d factor = _mm256_set1_pd(sigi->Factor());
+        const __m256d offset = _mm256_set1_pd(sigi->Offset());
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            __m256d value = avx2_raw_to_double<T>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(raw + i)));
+            if constexpr (!aIdentity)
+            {
+                value = _mm256_mul_pd(value, factor);
+                DBCPPP_NO_CONTRACT(value);
+                value = _mm256_add_pd(value, offset);
+            }
+            _mm256_storeu_pd(phys + i, value);
+        }
+        for (; i < n; i++)
+        {
+            phys[i] = sig->RawToPhys(raw[i]);
+        }
+    }
+    template <class T, bool aIdentity>
+    DBCPPP_TARGET("avx2") void avx2_phys_to_raw_batch(const ISignal* sig, const double* phys, ISignal::raw_t* raw, std::size_t n) noexcept
+    {
+        static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "AVX2 can't convert double to 64 bit integers");
+        const SignalImpl* sigi = static_cast<const SignalImpl*>(sig);
+        const __m256d factor = _mm256_set1_pd(sigi->Factor());
+        const __m256d offset = _mm256_set1_pd(sigi->Offset());
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            __m256d value = _mm256_loadu_pd(phys + i);
+            if constexpr (!aIdentity)
+            {
+                value = _mm256_div_pd(_mm256_sub_pd(value, offset), factor);
+            }
+            __m256i result;
+            if constexpr (std::is_same_v<T, float>)
+            {
+                result = _mm256_cvtepu32_epi64(_mm_castps_si128(_mm256_cvtpd_ps(value)));
+            }
+            else
+            {
+                result = _mm256_castpd_si256(value);
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(raw + i), result);
+        }
+        for (; i < n; i++)
+        {
+            raw[i] = sig->PhysToRaw(phys[i]);
+        }
+    }
+#if defined(__GNUC__) && !defined(__clang__)
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wuninitialized"
+#   pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+    template <class T>
+    DBCPPP_TARGET("avx512f,avx512bw,avx512dq") inline __m512d avx512_raw_to_double(__m512i raw) noexcept
+    {
+        if constexpr (std::is_same_v<T, int64_t>)
+        {
+            return _mm512_cvtepi64_pd(raw);
+        }
+        else if constexpr (std::is_same_v<T, uint64_t>)
+        {
+            return _mm512_cvtepu64_pd(raw);
+        }
+        else if constexpr (std::is_same_v<T, float>)
+        {
+            return _mm512_cvtps_pd(_mm256_castsi256_ps(_mm512_cvtepi64_epi32(raw)));
+        }
+        else
+        {
+            return _mm512_castsi512_pd(raw);
+        }
+    }
+    template <class T, bool aIdentity>
+    DBCPPP_TARGET("avx512f,avx512bw,avx512dq") void avx512_raw_to_phys_batch(const ISignal* sig, const ISignal::raw_t* raw, double* phys, std::size_t n) noexcept
+    {
+        const SignalImpl* sigi = static_cast<const SignalImpl*>(sig);
+        const __m512d factor = _mm512_set1_pd(sigi->Factor());
+        const __m512d offset = _mm512_set1_pd(sigi->Offset());
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            __m512d value = avx512_raw_to_double<T>(_mm512_loadu_si512(raw + i));
+            if constexpr (!aIdentity)
+            {
+                value = _mm512_mul_pd(value, factor);
+                DBCPPP_NO_CONTRACT(value);
+                value = _mm512_add_pd(value, offset);
+            }
+            _mm512_storeu_pd(phys + i, value);
+        }
+        for (; i < n; i++)
+        {
+            phys[i] = sig->RawToPhys(raw[i]);
+        }
+    }
+    template <class T, bool aIdentity>
+    DBCPPP_TARGET("avx512f,avx512bw,avx512dq") void avx512_phys_to_raw_batch(const ISignal* sig, const double* phys, ISignal::raw_t* raw, std::size_t n) noexcept
+    {
+        const SignalImpl* sigi = static_cast<const SignalImpl*>(sig);
+        const __m512d factor = _mm512_set1_pd(sigi->Factor());
+        const __m512d offset = _mm512_set1_pd(sigi->Offset());
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            __m512d value = _mm512_loadu_pd(phys + i);
+            if constexpr (!aIdentity)
+            {
+                value = _mm512_div_pd(_mm512_sub_pd(value, offset), factor);
+            }
+            __m512i result;
+            if constexpr (std::is_same_v<T, int64_t>)
+            {
+                result = _mm512_cvttpd_epi64(value);
+            }
+            else if constexpr (std::is_same_v<T, uint64_t>)
+            {
+                // like phys_to_raw_cast, negative values are converted through int64_t
+                __mmask8 negative = _mm512_cmp_pd_mask(value, _mm512_setzero_pd(), _CMP_LT_OQ);
+                result = _mm512_mask_blend_epi64(negative, _mm512_cvttpd_epu64(value), _mm512_cvttpd_epi64(value));
+            }
+            else if constexpr (std::is_same_v<T, float>)
+            {
+                result = _mm512_cvtepu32_epi64(_mm256_castps_si256(_mm512_cvtpd_ps(value)));
+            }
+            else
+            {
+                result = _mm512_castpd_si512(value);
+            }
+            _mm512_storeu_si512(raw + i, result);
+        }
+        for (; i < n; i++)
+        {
+            raw[i] = sig->PhysToRaw(phys[i]);
+        }
+    }
+#if defined(__GNUC__) && !defined(__clang__)
+#   pragma GCC diagnostic pop
+#endif
+
+    struct SSE42
+    {
+        template <Alignment aAlignment, ISignal::EByteOrder aByteOrder, ISignal::EValueType aValueType, ISignal::EExtendedValueType aExtendedValueType>
+        static constexpr simd_decode_batch_func_t decode_batch = sse42_decode_batch<aAlignment, aByteOrder, aValueType, aExtendedValueType>;
+    };
+    struct AVX2
+    {
+        template <Alignment aAlignment, ISignal::EByteOrder aByteOrder, ISignal::EValueType aValueType, ISignal::EExtendedValueType aExtendedValueType>
+        static constexpr simd_decode_batch_func_t decode_batch = avx2_decode_batch<aAlignment, aByteOrder, aValueType, aExtendedValueType>;
+        template <class T, bool aIdentity>
+        static constexpr raw_to_phys_batch_func_t raw_to_phys_batch = avx2_raw_to_phys_batch<T, aIdentity>;
+        template <class T, bool aIdentity>
+        static constexpr phys_to_raw_batch_func_t phys_to_raw_batch = avx2_phys_to_raw_batch<T, aIdentity>;
+        static constexpr bool integer_phys_to_raw = false;
+    };
+    struct AVX512
+    {
+        template <Alignment aAlignment, ISignal::EByteOrder aByteOrder, ISignal::EValueType aValueType, ISignal::EExtendedValueType aExtendedValueType>
+        static constexpr simd_decode_batch_func_t decode_batch = avx512_decode_batch<aAlignment, aByteOrder, aValueType, aExtendedValueType>;
+        template <class T, bool aIdentity>
+        static constexpr raw_to_phys_batch_func_t raw_to_phys_batch = avx512_raw_to_phys_batch<T, aIdentity>;
+        template <class T, bool aIdentity>
+        static constexpr phys_to_raw_batch_func_t phys_to_raw_batch = avx512_phys_to_raw_batch<T, aIdentity>;
+        static constexpr bool integer_phys_to_raw = true;
+    };
+
+    template <class Isa, Alignment aAlignment, ISignal::EByteOrder aByteOrder, ISignal::EValueType aValueType>
+    simd_decode_batch_func_t select_decode_batch(ISignal::EExtendedValueType evt)
+    {
+        switch (evt)
+        {
+        case ISignal::EExtendedValueType::Integer: return Isa::template decode_batch<aAlignment, aByteOrder, aValueType, ISignal::EExtendedValueType::Integer>;
+        case ISignal::EExtendedValueType::Float:   return Isa::template decode_batch<aAlignment, aByteOrder, aValueType, ISignal::EExtendedValueType::Float>;
+        case ISignal::EExtendedValueType::Double:  return Isa::template decode_batch<aAlignment, aByteOrder, aValueType, ISignal::EExtendedValueType::Double>;
+        }
+        return nullptr;
+    }
+    template <class Isa, Alignment aAlignment, ISignal::EByteOrder aByteOrder>
+    simd_decode_batch_func_t select_decode_batch(ISignal::EValueType vt, ISignal::EExtendedValueType evt)
+    {
+        switch (vt)
+        {
+        case ISignal::EValueType::Signed:   return select_decode_batch<Isa, aAlignment, aByteOrder, ISignal::EValueType::Signed>(evt);
+        case ISignal::EValueType::Unsigned: return select_decode_batch<Isa, aAlignment, aByteOrder, ISignal::EValueType::Unsigned>(evt);
+        }
+        return nullptr;
+    }
+    template <class Isa, Alignment aAlignment>
+    simd_decode_batch_func_t select_decode_batch(ISignal::EByteOrder bo, ISignal::EValueType vt, ISignal::EExtendedValueType evt)
+    {
+        switch (bo)
+        {
+        case ISignal::EByteOrder::LittleEndian: return select_decode_batch<Isa, aAlignment, ISignal::EByteOrder::LittleEndian>(vt, evt);
+        case ISignal::EByteOrder::BigEndian:    return select_decode_batch<Isa, aAlignment, ISignal::EByteOrder::BigEndian>(vt, evt);
+        }
+        return nullptr;
+    }
+    template <class Isa>
+    simd_decode_batch_func_t select_decode_batch(Alignment a, ISignal::EByteOrder bo, ISignal::EValueType vt, ISignal::EExtendedValueType evt)
+    {
+        constexpr auto si64b            = Alignment::size_inbetween_first_64_bit;
+        constexpr auto se64bsbsfi64b    = Alignment::signal_exceeds_64_bit_size_but_signal_fits_into_64_bit;
+        constexpr auto se64bsasdnfi64b  = Alignment::signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit;
+        switch (a)
+        {
+        case si64b:           return select_decode_batch<Isa, si64b>(bo, vt, evt);
+        case se64bsbsfi64b:   return select_decode_batch<Isa, se64bsbsfi64b>(bo, vt, evt);
+        case se64bsasdnfi64b: return select_decode_batch<Isa, se64bsasdnfi64b>(bo, vt, evt);
+        }
+        return nullptr;
+    }
+
+    template <class Isa, class T>
+    raw_to_phys_batch_func_t select_raw_to_phys_batch(bool identity)
+    {
+        return identity ? Isa::template raw_to_phys_batch<T, true> : Isa::template raw_to_phys_batch<T, false>;
+    }
+    template <class Isa>
+    raw_to_phys_batch_func_t select_raw_to_phys_batch(ISignal::EValueType vt, ISignal::EExtendedValueType evt, bool identity)
+    {
+        switch (evt)
+        {
+        case ISignal::EExtendedValueType::Integer:
+            if (vt == ISignal::EValueType::Signed)
+            {
+                return select_raw_to_phys_batch<Isa, int64_t>(identity);
+            }
+            return select_raw_to_phys_batch<Isa, uint64_t>(identity);
+        case ISignal::EExtendedValueType::Float:  return select_raw_to_phys_batch<Isa, float>(identity);
+        case ISignal::EExtendedValueType::Double: return select_raw_to_phys_batch<Isa, double>(identity);
+        }
+        return nullptr;
+    }
+    template <class Isa, class T>
+    phys_to_raw_batch_func_t select_phys_to_raw_batch(bool identity)
+    {
+        if constexpr (std::is_integral_v<T> && !Isa::integer_phys_to_raw)
+        {
+            return nullptr;
+        }
+        else
+        {
+            return identity ? Isa::template phys_to_raw_batch<T, true> : Isa::template phys_to_raw_batch<T, false>;
+        }
+    }
+    template <class Isa>
+    phys_to_raw_batch_func_t select_phys_to_raw_batch(ISignal::EValueType vt, ISignal::EExtendedValueType evt, bool identity)
+    {
+        switch (evt)
+        {
+        case ISignal::EExtendedValueType::Integer:
+            if (vt == ISignal::EValueType::Signed)
+            {
+                return select_phys_to_raw_batch<Isa, int64_t>(identity);
+            }
+            return select_phys_to_raw_batch<Isa, uint64_t>(identity);
+        case ISignal::EExtendedValueType::Float:  return select_phys_to_raw_batch<Isa, float>(identity);
+        case ISignal::EExtendedValueType::Double: return select_phys_to_raw_batch<Isa, double>(identity);
+        }
+        return nullptr;
+    }
+}
+
+#endif
+
+simd_decode_batch_func_t dbcppp::make_simd_decode_batch(
+      ISignal::ESIMDLevel level
+    , Alignment a
+    , ISignal::EByteOrder bo
+    , ISignal::EValueType vt
+    , ISignal::EExtendedValueType evt)
+{
+#ifdef DBCPPP_X86_SIMD
+    switch (level)
+    {
+    case ISignal::ESIMDLevel::None:   break;
+    case ISignal::ESIMDLevel::SSE42:  return select_decode_batch<SSE42>(a, bo, vt, evt);
+    case ISignal::ESIMDLevel::AVX2:   return select_decode_batch<AVX2>(a, bo, vt, evt);
+    case ISignal::ESIMDLevel::AVX512: return select_decode_batch<AVX512>(a, bo, vt, evt);
+    }
+#endif
+    return nullptr;
+}
+raw_to_phys_batch_func_t dbcppp::make_simd_raw_to_phys_batch(
+      ISignal::ESIMDLevel level
+    , ISignal::EValueType vt
+    , ISignal::EExtendedValueType evt
+    , bool identity)
+{
+#ifdef DBCPPP_X86_SIMD
+    switch (level)
+    {
+    case ISignal::ESIMDLevel::None:   break;
+    // SSE4.2 only has 2 double lanes and no 64 bit integer conversions, the scalar loop is as fast
+    case ISignal::ESIMDLevel::SSE42:  break;
+    case ISignal::ESIMDLevel::AVX2:   return select_raw_to_phys_batch<AVX2>(vt, evt, identity);
+    case ISignal::ESIMDLevel::AVX512: return select_raw_to_phys_batch<AVX512>(vt, evt, identity);
+    }
+#endif
+    return nullptr;
+}
+phys_to_raw_batch_func_t dbcppp::make_simd_phys_to_raw_batch(
+      ISignal::ESIMDLevel level
+    , ISignal::EValueType vt
+    , ISignal::EExtendedValueType evt
+    , bool identity)
+{
+#ifdef DBCPPP_X86_SIMD
+    switch (level)
+    {
+    case ISignal::ESIMDLevel::None:   break;
+    case ISignal::ESIMDLevel::SSE42:  break;
+    case ISignal::ESIMDLevel::AVX2:   return select_phys_to_raw_batch<AVX2>(vt, evt, identity);
+    case ISignal::ESIMDLevel::AVX512: return select_phys_to_raw_batch<AVX512>(vt, evt, identity);
+    }
+#endif
+    return nullptr;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "SignalImpl.h"
+
+namespace dbcppp
+{
+    using simd_decode_batch_func_t = std::size_t (*)(const SignalImpl* sig, const uint8_t* frames, std::size_t stride, std::size_t count, ISignal::raw_t* values) noexcept;
+
+    // returns the vectorized batch decode kernel for the given instruction set or nullptr if there is none
+    simd_decode_batch_func_t make_simd_decode_batch(
+          ISignal::ESIMDLevel level
+        , Alignment a
+        , ISignal::EByteOrder bo
+        , ISignal::EValueType vt
+        , ISignal::EExtendedValueType evt);
+
+    using raw_to_phys_batch_func_t = void (*)(const ISignal* sig, const ISignal::raw_t* raw, double* phys, std::size_t n) noexcept;
+    using phys_to_raw_batch_func_t = void (*)(const ISignal* sig, const double* phys, ISignal::raw_t* raw, std::size_t n) noexcept;
+
+    // returns the vectorized RawToPhysBatch/PhysToRawBatch kernel for the given instruction set or nullptr if there is none,
+    // the kernels produce exactly the same results as the scalar RawToPhys/PhysToRaw
+    raw_to_phys_batch_func_t make_simd_raw_to_phys_batch(
+          ISignal::ESIMDLevel level
+        , ISignal::EValueType vt
+        , ISignal::EExtendedValueType evt
+        , bool identity);
+    phys_to_raw_batch_func_t make_simd_phys_to_raw_batch(
+          ISignal::ESIMDLevel level
+        , ISignal::EValueType vt
+        , ISignal::EExtendedValueType evt
+        , bool identity);
+}
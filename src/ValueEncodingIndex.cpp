@@ -0,0 +1,86 @@
+#include <algorithm>
+#include "ValueEncodingIndex.h"
+
+using namespace dbcppp;
+
+ValueEncodingIndex::ValueEncodingIndex(const std::vector<ValueEncodingDescriptionImpl>& descriptions)
+{
+    if (descriptions.empty())
+    {
+        return;
+    }
+    // if a value or description appears more than once the first one wins, like a linear search would find it
+    std::vector<uint32_t> indices(descriptions.size());
+    for (uint32_t i = 0; i < indices.size(); i++)
+    {
+        indices[i] = i;
+    }
+    auto value_less = [&](uint32_t lhs, uint32_t rhs) { return descriptions[lhs].Value() < descriptions[rhs].Value(); };
+    auto value_equal = [&](uint32_t lhs, uint32_t rhs) { return descriptions[lhs].Value() == descriptions[rhs].Value(); };
+    std::stable_sort(indices.begin(), indices.end(), value_less);
+    indices.erase(std::unique(indices.begin(), indices.end(), value_equal), indices.end());
+
+    int64_t min = descriptions[indices.front()].Value();
+    int64_t max = descriptions[indices.back()].Value();
+    uint64_t range = uint64_t(max) - uint64_t(min) + 1;
+    // enums usually count up from 0, a table with a few holes is still small
+    if (range != 0 && range <= 64 + 4 * uint64_t(indices.size()))
+    {
+        _dense_base = min;
+        _dense.assign(std::size_t(range), none);
+        for (auto i : indices)
+        {
+            _dense[std::size_t(uint64_t(descriptions[i].Value()) - uint64_t(min))] = i;
+        }
+    }
+    else
+    {
+        _by_value = indices;
+    }
+
+    _by_description.resize(descriptions.size());
+    for (uint32_t i = 0; i < _by_description.size(); i++)
+    {
+        _by_description[i] = i;
+    }
+    auto description_less = [&](uint32_t lhs, uint32_t rhs) { return descriptions[lhs].Description() < descriptions[rhs].Description(); };
+    auto description_equal = [&](uint32_t lhs, uint32_t rhs) { return descriptions[lhs].Description() == descriptions[rhs].Description(); };
+    std::stable_sort(_by_description.begin(), _by_description.end(), description_less);
+    _by_description.erase(std::unique(_by_description.begin(), _by_description.end(), description_equal), _by_description.end());
+}
+std::optional<std::string_view> ValueEncodingIndex::find(const std::vector<ValueEncodingDescriptionImpl>& descriptions, int64_t value) const noexcept
+{
+    uint32_t index = none;
+    if (!_dense.empty())
+    {
+        uint64_t offset = uint64_t(value) - uint64_t(_dense_base);
+        if (offset < _dense.size())
+        {
+            index = _dense[std::size_t(offset)];
+        }
+    }
+    else
+    {
+        auto iter = std::lower_bound(_by_value.begin(), _by_value.end(), value,
+            [&](uint32_t i, int64_t v) { return descriptions[i].Value() < v; });
+        if (iter != _by_value.end() && descriptions[*iter].Value() == value)
+        {
+            index = *iter;
+        }
+    }
+    if (index == none)
+    {
+        return std::nullopt;
+    }
+    return std::string_view(descriptions[index].Description());
+}
+std::optional<int64_t> ValueEncodingIndex::find(const std::vector<ValueEncodingDescriptionImpl>& descriptions, std::string_view description) const noexcept
+{
+    auto iter = std::lower_bound(_by_description.begin(), _by_description.end(), description,
+        [&](uint32_t i, std::string_view d) { return std::string_view(descriptions[i].Description()) < d; });
+    if (iter != _by_description.end() && descriptions[*iter].Description() == description)
+    {
+        return descriptions[*iter].Value();
+    }
+    return std::nullopt;
+}
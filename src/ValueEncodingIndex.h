@@ -0,0 +1,34 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include "ValueEncodingDescriptionImpl.h"
+
+namespace dbcppp
+{
+    // Lookup of value encoding descriptions in both directions. Only indices into the descriptions
+    // are stored, so the index stays valid when its owner (and the descriptions with it) is copied.
+    class ValueEncodingIndex
+    {
+    public:
+        ValueEncodingIndex() = default;
+        ValueEncodingIndex(const std::vector<ValueEncodingDescriptionImpl>& descriptions);
+
+        std::optional<std::string_view> find(const std::vector<ValueEncodingDescriptionImpl>& descriptions, int64_t value) const noexcept;
+        std::optional<int64_t> find(const std::vector<ValueEncodingDescriptionImpl>& descriptions, std::string_view description) const noexcept;
+
+    private:
+        static constexpr uint32_t none = uint32_t(-1);
+
+        // contiguous values: _dense[value - _dense_base] is the index of the description or none
+        int64_t _dense_base = 0;
+        std::vector<uint32_t> _dense;
+        // otherwise: indices sorted by value
+        std::vector<uint32_t> _by_value;
+        // indices sorted by description
+        std::vector<uint32_t> _by_description;
+    };
+}
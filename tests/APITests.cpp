@@ -2,6 +2,7 @@
 #include "Catch2.h"
 #include <dbcppp/CApi.h>
 #include <dbcppp/Network.h>
+#include <dbcppp/BusRouter.h>
 
 using namespace dbcppp;
 
@@ -209,6 +210,51 @@ TEST_CASE("API Test: Signal", "[]")
         REQUIRE(dbcppp_SignalReceivers_Get(sig, 0) == std::string("Vector__XXX"));
     }
 }
+TEST_CASE("API Test: ValueEncodingDescription lookup", "[]")
+{
+    constexpr const char* test_dbc =
+        "VERSION \"\"\n"
+        "NS_ :\n"
+        "BS_:\n"
+        "BU_:\n"
+        "BO_ 1 Msg0: 8 Sender0\n"
+        "  SG_ Sig0: 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        "  SG_ Sig1: 8|32@1- (1,0) [0|0] \"\" Vector__XXX\n"
+        "EV_ EnvVarName : 0 [1|2] \"Unit\" 5.5 1 DUMMY_NODE_VECTOR0 Node0;\n"
+        "VAL_ 1 Sig0 0 \"Off\" 1 \"On\" 3 \"Error\" ;\n"
+        "VAL_ 1 Sig1 -5 \"Negative\" 1000000 \"Big\" 7 \"Seven\" ;\n"
+        "VAL_ EnvVarName 1 \"One\" 2 \"Two\" ;\n";
+
+    std::istringstream iss(test_dbc);
+    auto net = INetwork::LoadDBCFromIs(iss);
+    REQUIRE(net);
+    auto clone = net->Clone();
+    for (const INetwork* n : {net.get(), clone.get()})
+    {
+        const ISignal& sig0 = n->Messages_Get(0).Signals_Get(0);
+        REQUIRE(sig0.ValueToDescription(0) == "Off");
+        REQUIRE(sig0.ValueToDescription(1) == "On");
+        REQUIRE(!sig0.ValueToDescription(2));
+        REQUIRE(sig0.ValueToDescription(3) == "Error");
+        REQUIRE(!sig0.ValueToDescription(-1));
+        REQUIRE(!sig0.ValueToDescription(4));
+        REQUIRE(sig0.DescriptionToValue("Error") == 3);
+        REQUIRE(!sig0.DescriptionToValue("Unknown"));
+
+        const ISignal& sig1 = n->Messages_Get(0).Signals_Get(1);
+        REQUIRE(sig1.ValueToDescription(-5) == "Negative");
+        REQUIRE(sig1.ValueToDescription(7) == "Seven");
+        REQUIRE(sig1.ValueToDescription(1000000) == "Big");
+        REQUIRE(!sig1.ValueToDescription(8));
+        REQUIRE(sig1.DescriptionToValue("Negative") == -5);
+        REQUIRE(sig1.DescriptionToValue("Big") == 1000000);
+
+        const IEnvironmentVariable& ev = n->EnvironmentVariables_Get(0);
+        REQUIRE(ev.ValueToDescription(2) == "Two");
+        REQUIRE(!ev.ValueToDescription(0));
+        REQUIRE(ev.DescriptionToValue("One") == 1);
+    }
+}
 TEST_CASE("API Test: Message", "[]")
 {
     constexpr const char* test_dbc =
@@ -244,3 +290,202 @@ TEST_CASE("API Test: Message", "[]")
         REQUIRE(dbcppp_MessageSignals_Size(msg) == 3);
     }
 }
+TEST_CASE("API Test: MessageById", "[]")
+{
+    constexpr const char* test_dbc =
+        "VERSION \"\"\n"
+        "NS_ :\n"
+        "BS_:\n"
+        "BU_:\n"
+        "BO_ 291 Standard: 8 Vector__XXX\n"
+        "BO_ 2147483939 Extended: 8 Vector__XXX\n"
+        "BO_ 3221225472 VECTOR__INDEPENDENT_SIG_MSG: 0 Vector__XXX\n"
+        "BO_ 2147483648 ExtendedZero: 8 Vector__XXX\n"
+        "BO_ 2684354559 ExtendedMax: 8 Vector__XXX\n"
+        "BO_ 2047 StandardMax: 8 Vector__XXX\n"
+        "BO_ 291 Duplicate: 8 Vector__XXX\n";
+
+    SECTION("CPP API")
+    {
+        std::istringstream iss(test_dbc);
+        auto net = INetwork::LoadDBCFromIs(iss);
+        REQUIRE(net);
+
+        REQUIRE(net->MessageById(0x123)->Name() == "Standard");
+        REQUIRE(net->MessageById(0x7FF)->Name() == "StandardMax");
+        // the standard and the extended id 0x123 are different messages
+        REQUIRE(net->MessageById(0x80000123)->Name() == "Extended");
+        REQUIRE(net->MessageById(0x80000000)->Name() == "ExtendedZero");
+        REQUIRE(net->MessageById(0x9FFFFFFF)->Name() == "ExtendedMax");
+        // RTR flag of a SocketCAN can_id
+        REQUIRE(net->MessageById(0xC0000123)->Name() == "Extended");
+        // RTR and error flags of a standard frame's can_id
+        REQUIRE(net->MessageById(0x40000123)->Name() == "Standard");
+        REQUIRE(net->MessageById(0x200007FF)->Name() == "StandardMax");
+        // the pseudo message doesn't shadow the extended id 0 and isn't found itself
+        REQUIRE(net->MessageById(0xC0000000)->Name() == "ExtendedZero");
+        REQUIRE(net->MessageById(0x40000000) == nullptr);
+        REQUIRE(net->MessageById(0) == nullptr);
+        REQUIRE(net->MessageById(0x80000124) == nullptr);
+        REQUIRE(net->MessageById(0x800) == nullptr);
+
+        // the index is rebuilt by Merge and copied by Clone
+        std::istringstream iss_other(
+            "VERSION \"\"\n"
+            "NS_ :\n"
+            "BS_:\n"
+            "BU_:\n"
+            "BO_ 2164260864 Merged: 8 Vector__XXX\n"
+            "BO_ 16 MergedStandard: 8 Vector__XXX\n");
+        net->Merge(INetwork::LoadDBCFromIs(iss_other));
+        auto clone = net->Clone();
+        for (const INetwork* n : {net.get(), clone.get()})
+        {
+            REQUIRE(n->MessageById(0x81000000)->Name() == "Merged");
+            REQUIRE(n->MessageById(16)->Name() == "MergedStandard");
+            REQUIRE(n->MessageById(0x80000123)->Name() == "Extended");
+            for (const IMessage& msg : n->Messages())
+            {
+                if (msg.Name() != "Duplicate" && msg.Name() != "VECTOR__INDEPENDENT_SIG_MSG")
+                {
+                    REQUIRE(n->MessageById(msg.Id()) == &msg);
+                }
+            }
+        }
+    }
+    SECTION("C API")
+    {
+        auto net = dbcppp_NetworkLoadDBCFromMemory(test_dbc);
+        REQUIRE(net);
+
+        auto msg = dbcppp_NetworkMessageById(net, 0x80000123);
+        REQUIRE(msg);
+        REQUIRE(std::string(dbcppp_MessageName(msg)) == "Extended");
+        REQUIRE(dbcppp_NetworkMessageById(net, 0x124) == nullptr);
+        dbcppp_NetworkFree(net);
+    }
+}
+TEST_CASE("API Test: ParentMessage and handles", "[]")
+{
+    constexpr const char* test_dbc =
+        "VERSION \"\"\n"
+        "NS_ :\n"
+        "BS_:\n"
+        "BU_:\n"
+        "BO_ 1 Msg0: 8 Vector__XXX\n"
+        "  SG_ Sig0 : 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        "  SG_ Sig1 : 8|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        "BO_ 2 Msg1: 8 Vector__XXX\n"
+        "  SG_ Sig2 : 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\n";
+    constexpr const char* other_dbc =
+        "VERSION \"\"\n"
+        "NS_ :\n"
+        "BS_:\n"
+        "BU_:\n"
+        "BO_ 3 Msg2: 8 Vector__XXX\n"
+        "  SG_ Sig3 : 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        "  SG_ Sig4 : 8|8@1+ (1,0) [0|0] \"\" Vector__XXX\n";
+
+    std::istringstream iss(test_dbc);
+    auto net = INetwork::LoadDBCFromIs(iss);
+    REQUIRE(net);
+    std::istringstream iss_other(other_dbc);
+    auto other = INetwork::LoadDBCFromIs(iss_other);
+    REQUIRE(other);
+    // signals and messages of other networks are rejected
+    REQUIRE(net->ParentMessage(&other->Messages_Get(0).Signals_Get(1)) == nullptr);
+    REQUIRE(!net->SignalHandleOf(&other->Messages_Get(0).Signals_Get(0)));
+    REQUIRE(!net->MessageIndexOf(&other->Messages_Get(0)));
+    auto standalone = ISignal::Create(8, "Sig", ISignal::EMultiplexer::NoMux, 0, 0, 8, ISignal::EByteOrder::LittleEndian,
+        ISignal::EValueType::Unsigned, 1.0, 0.0, 0.0, 0.0, "", {}, {}, {}, "", ISignal::EExtendedValueType::Integer, {});
+    REQUIRE(net->ParentMessage(standalone.get()) == nullptr);
+    REQUIRE(net->ParentMessage(nullptr) == nullptr);
+    REQUIRE(!net->SignalHandleOf(nullptr));
+    REQUIRE(!net->MessageIndexOf(nullptr));
+
+    net->Merge(std::move(other));
+    auto clone = net->Clone();
+    for (const INetwork* n : {net.get(), clone.get()})
+    {
+        REQUIRE(n->Messages_Size() == 3);
+        for (std::size_t i = 0; i < n->Messages_Size(); i++)
+        {
+            const IMessage& msg = n->Messages_Get(i);
+            REQUIRE(n->MessageIndexOf(&msg) == i);
+            for (std::size_t j = 0; j < msg.Signals_Size(); j++)
+            {
+                const ISignal& sig = msg.Signals_Get(j);
+                REQUIRE(n->ParentMessage(&sig) == &msg);
+                auto handle = n->SignalHandleOf(&sig);
+                REQUIRE(handle);
+                REQUIRE(handle->message == i);
+                REQUIRE(handle->signal == j);
+                REQUIRE(&n->SignalByHandle(*handle) == &sig);
+            }
+        }
+    }
+    // the signals of the clone belong to the clone only
+    REQUIRE(net->ParentMessage(&clone->Messages_Get(2).Signals_Get(0)) == nullptr);
+}
+TEST_CASE("API Test: BusRouter", "[]")
+{
+    std::istringstream iss_powertrain(
+        "VERSION \"\"\n"
+        "NS_ :\n"
+        "BS_:\n"
+        "BU_:\n"
+        "BO_ 256 Engine: 8 Vector__XXX\n"
+        "BO_ 2147483904 EngineExtended: 8 Vector__XXX\n");
+    std::istringstream iss_chassis(
+        "VERSION \"\"\n"
+        "NS_ :\n"
+        "BS_:\n"
+        "BU_:\n"
+        "BO_ 256 Brakes: 8 Vector__XXX\n"
+        "BO_ 512 Steering: 8 Vector__XXX\n");
+    auto powertrain = INetwork::LoadDBCFromIs(iss_powertrain);
+    auto chassis = INetwork::LoadDBCFromIs(iss_chassis);
+    REQUIRE(powertrain);
+    REQUIRE(chassis);
+
+    auto router = IBusRouter::Create();
+    router->SetBus(0, powertrain.get());
+    router->SetBus(3, chassis.get());
+    REQUIRE(router->Buses_Size() == 4);
+    REQUIRE(router->Bus(0) == powertrain.get());
+    REQUIRE(router->Bus(1) == nullptr);
+    REQUIRE(router->Bus(3) == chassis.get());
+    REQUIRE(router->Bus(100) == nullptr);
+
+    // the same id means different messages on different buses
+    REQUIRE(router->Route(0, 0x100)->Name() == "Engine");
+    REQUIRE(router->Route(3, 0x100)->Name() == "Brakes");
+    REQUIRE(router->Route(0, 0x80000100)->Name() == "EngineExtended");
+    REQUIRE(router->Route(3, 0x200)->Name() == "Steering");
+    REQUIRE(router->Route(0, 0x200) == nullptr);
+    REQUIRE(router->Route(0, 0x200) == nullptr);
+    REQUIRE(router->Route(3, 0x300) == nullptr);
+    REQUIRE(router->Route(1, 0x100) == nullptr);
+    REQUIRE(router->Route(100, 0x100) == nullptr);
+
+    REQUIRE(router->Routed() == 4);
+    REQUIRE(router->Unrouted() == 5);
+    REQUIRE(router->Unrouted(0) == 2);
+    REQUIRE(router->Unrouted(1) == 0);
+    REQUIRE(router->Unrouted(3) == 1);
+    REQUIRE(router->UnknownBus() == 2);
+
+    // removing a bus keeps its counter, its frames count as unknown bus from then on
+    router->SetBus(3, nullptr);
+    REQUIRE(router->Route(3, 0x100) == nullptr);
+    REQUIRE(router->Unrouted(3) == 1);
+    REQUIRE(router->UnknownBus() == 3);
+    router->SetBus(1, chassis.get());
+    REQUIRE(router->Route(1, 0x100)->Name() == "Brakes");
+
+    router->ResetCounters();
+    REQUIRE(router->Routed() == 0);
+    REQUIRE(router->Unrouted() == 0);
+    REQUIRE(router->Unrouted(0) == 0);
+    REQUIRE(router->UnknownBus() == 0);
+}
@@ -1,3 +1,4 @@
+#include <map>
 #include <array>
 #include <fstream>
 #include <iostream>
@@ -7,11 +8,22 @@
 #include <chrono>
 #include <random>
 #include <string>
+#include <sstream>
 #include <iomanip>
+#include <cstring>
+#include <cmath>
 
 #include "../include/dbcppp/Network2Functions.h"
 #include "../include/dbcppp/CApi.h"
 #include "../include/dbcppp/Network.h"
+#include "../include/dbcppp/StaticSignal.h"
+#include "../include/dbcppp/DecodeCache.h"
+#include "../include/dbcppp/MessageView.h"
+#include "../include/dbcppp/FrameBuilder.h"
+#include "../include/dbcppp/Projection.h"
+#include "../include/dbcppp/Predicate.h"
+
+#include "Config.h"
 
 #include "Catch2.h"
 
@@ -142,6 +154,46 @@ uint64_t easy_decode(dbcppp::ISignal& sig, std::vector<uint8_t>& data)
     }
     return result;
 }
+void easy_encode(dbcppp::ISignal& sig, uint64_t raw, std::vector<uint8_t>& data)
+{
+    if (sig.ByteOrder() == dbcppp::ISignal::EByteOrder::BigEndian)
+    {
+        auto dstBit = sig.StartBit();
+        auto srcBit = sig.BitSize() - 1;
+        for (auto i = 0; i < sig.BitSize(); i++)
+        {
+            data[dstBit / 8] &= ~(1 << (dstBit % 8));
+            if (raw & (1ull << srcBit))
+            {
+                data[dstBit / 8] |= 1 << (dstBit % 8);
+            }
+            if ((dstBit % 8) == 0)
+            {
+                dstBit += 15;
+            }
+            else
+            {
+                --dstBit;
+            }
+            --srcBit;
+        }
+    }
+    else
+    {
+        auto dstBit = sig.StartBit();
+        auto srcBit = 0;
+        for (auto i = 0; i < sig.BitSize(); i++)
+        {
+            data[dstBit / 8] &= ~(1 << (dstBit % 8));
+            if (raw & (1ull << srcBit))
+            {
+                data[dstBit / 8] |= 1 << (dstBit % 8);
+            }
+            ++dstBit;
+            ++srcBit;
+        }
+    }
+}
 TEST_CASE("Decoding")
 {
     using namespace dbcppp;
@@ -183,4 +235,1453 @@ TEST_CASE("Decoding")
         REQUIRE(*reinterpret_cast<uint64_t*>(&dec_easy) == *reinterpret_cast<uint64_t*>(&dec_sig));
     }
     //BOOST_TEST_MESSAGE("Done!");
-}
\ No newline at end of file
+}
+TEST_CASE("DecodingBatch")
+{
+    using namespace dbcppp;
+
+    std::size_t n_tests = 1000;
+    std::size_t n_frames = 33;
+    std::size_t max_msg_byte_size = 64;
+
+    uint32_t seed = static_cast<uint32_t>(time(0));
+    std::default_random_engine rng(seed);
+
+    // every instruction set the machine supports has to produce the same values as the scalar decode
+    auto supported = ISignal::SupportedSIMDLevel();
+    for (auto level : {ISignal::ESIMDLevel::None, ISignal::ESIMDLevel::SSE42, ISignal::ESIMDLevel::AVX2, ISignal::ESIMDLevel::AVX512})
+    {
+        if (level > supported)
+        {
+            break;
+        }
+        ISignal::SetSIMDLevel(level);
+        REQUIRE(ISignal::SIMDLevel() == level);
+        for (std::size_t i = 0; i < n_tests; i++)
+        {
+            auto sig = generate_random_signal(max_msg_byte_size, rng);
+            auto data = generate_random_data(max_msg_byte_size * n_frames, rng);
+            std::vector<ISignal::raw_t> values(n_frames);
+            sig->DecodeBatch(&data[0], max_msg_byte_size, n_frames, &values[0]);
+            for (std::size_t j = 0; j < n_frames; j++)
+            {
+                REQUIRE(values[j] == sig->Decode(&data[j * max_msg_byte_size]));
+            }
+        }
+    }
+    ISignal::SetSIMDLevel(supported);
+}
+TEST_CASE("ConversionBatch")
+{
+    using namespace dbcppp;
+
+    std::size_t n_tests = 200;
+    std::size_t n_values = 37;
+    std::size_t byte_size = 8;
+
+    uint32_t seed = static_cast<uint32_t>(time(0));
+    std::default_random_engine rng(seed);
+
+    struct Scaling { double factor; double offset; };
+    std::vector<Scaling> scalings{{1., 0.}, {0.1, -40.}, {3., 7.5}, {-0.003, 1e6}};
+    std::vector<std::pair<ISignal::EValueType, ISignal::EExtendedValueType>> types{
+          {ISignal::EValueType::Signed, ISignal::EExtendedValueType::Integer}
+        , {ISignal::EValueType::Unsigned, ISignal::EExtendedValueType::Integer}
+        , {ISignal::EValueType::Unsigned, ISignal::EExtendedValueType::Float}
+        , {ISignal::EValueType::Unsigned, ISignal::EExtendedValueType::Double}};
+
+    // the vectorized conversions have to be bit identical to the scalar ones
+    auto supported = ISignal::SupportedSIMDLevel();
+    for (auto level : {ISignal::ESIMDLevel::None, ISignal::ESIMDLevel::SSE42, ISignal::ESIMDLevel::AVX2, ISignal::ESIMDLevel::AVX512})
+    {
+        if (level > supported)
+        {
+            break;
+        }
+        ISignal::SetSIMDLevel(level);
+        for (const auto& scaling : scalings)
+        {
+            for (const auto& type : types)
+            {
+                uint64_t bit_size = type.second == ISignal::EExtendedValueType::Float ? 32 : 64;
+                auto sig = ISignal::Create(byte_size, "Signal", ISignal::EMultiplexer::NoMux, 0, 0, bit_size,
+                    ISignal::EByteOrder::LittleEndian, type.first, scaling.factor, scaling.offset, 0.0, 0.0, "", {}, {}, {}, "", type.second, {});
+                for (std::size_t i = 0; i < n_tests; i++)
+                {
+                    auto data = generate_random_data(byte_size * n_values, rng);
+                    std::vector<ISignal::raw_t> raws(n_values);
+                    sig->DecodeBatch(&data[0], byte_size, n_values, &raws[0]);
+                    std::vector<double> phys(n_values);
+                    sig->RawToPhysBatch(&raws[0], &phys[0], n_values);
+                    for (std::size_t j = 0; j < n_values; j++)
+                    {
+                        double expected = sig->RawToPhys(raws[j]);
+                        REQUIRE(std::memcmp(&phys[j], &expected, sizeof(double)) == 0);
+                    }
+                    if (type.second == ISignal::EExtendedValueType::Integer)
+                    {
+                        // values out of the range of the raw type included, they are converted the same way too
+                        std::uniform_int_distribution<int64_t> dist(-1000000, 1000000);
+                        const double specials[] = {std::nan(""), INFINITY, -INFINITY, 1e30, -1e30,
+                            9223372036854775808.0, 18446744073709551616.0, -9223372036854775808.0};
+                        for (std::size_t j = 0; j < n_values; j++)
+                        {
+                            double raw = j < std::size(specials) ? specials[j] : double(dist(rng)) + 0.37;
+                            phys[j] = raw * scaling.factor + scaling.offset;
+                        }
+                    }
+                    std::vector<ISignal::raw_t> raws_back(n_values);
+                    sig->PhysToRawBatch(&phys[0], &raws_back[0], n_values);
+                    for (std::size_t j = 0; j < n_values; j++)
+                    {
+                        REQUIRE(raws_back[j] == sig->PhysToRaw(phys[j]));
+                    }
+                }
+            }
+        }
+        auto sig = ISignal::Create(byte_size, "Signal", ISignal::EMultiplexer::NoMux, 0, 0, 64, ISignal::EByteOrder::LittleEndian,
+            ISignal::EValueType::Unsigned, 1.0, 0.0, 0.0, 0.0, "", {}, {}, {}, "", ISignal::EExtendedValueType::Integer, {});
+        std::vector<double> phys{-2.0, -0.5, std::nan(""), 1e30, -1e30, 3.0, -2.0, -2.0, -2.0};
+        std::vector<ISignal::raw_t> raws(phys.size());
+        sig->PhysToRawBatch(&phys[0], &raws[0], phys.size());
+        REQUIRE(raws[0] == 0xFFFFFFFFFFFFFFFEull);
+        REQUIRE(raws[1] == 0);
+        REQUIRE(raws[2] == 0xFFFFFFFFFFFFFFFFull);
+        REQUIRE(raws[3] == 0xFFFFFFFFFFFFFFFFull);
+        REQUIRE(raws[4] == 0x8000000000000000ull);
+        REQUIRE(raws[5] == 3);
+        REQUIRE(raws[8] == 0xFFFFFFFFFFFFFFFEull);
+    }
+    ISignal::SetSIMDLevel(supported);
+}
+TEST_CASE("Encoding")
+{
+    using namespace dbcppp;
+
+    std::size_t n_tests = 10000;
+    std::size_t max_msg_byte_size = 64;
+
+    uint32_t seed = static_cast<uint32_t>(time(0));
+    std::default_random_engine rng(seed);
+    std::uniform_int_distribution<uint64_t> dist(0, -1);
+
+    for (std::size_t i = 0; i < n_tests; i++)
+    {
+        auto sig = generate_random_signal(max_msg_byte_size, rng);
+        auto data = generate_random_data(max_msg_byte_size, rng);
+        uint64_t raw = dist(rng);
+        auto expected = data;
+        easy_encode(*sig, raw, expected);
+        sig->Encode(raw, &data[0]);
+        // the bits around the signal must be left untouched
+        REQUIRE(data == expected);
+        REQUIRE(sig->Decode(&data[0]) == easy_decode(*sig, expected));
+    }
+    // frames shorter than 8 bytes, the buffer holds only the frame
+    for (std::size_t i = 0; i < n_tests; i++)
+    {
+        std::size_t size = i % 7 + 1;
+        auto sig = generate_random_signal(size, rng);
+        // a big endian signal may still reach behind the frame, since short frames are checked against 8 bytes
+        uint64_t last_bit = sig->StartBit() + sig->BitSize() - 1;
+        if (sig->ByteOrder() == ISignal::EByteOrder::BigEndian)
+        {
+            last_bit = sig->StartBit() - sig->StartBit() % 8 + ((sig->BitSize() + 7 - sig->StartBit() % 8 - 1) / 8) * 8;
+        }
+        if (last_bit / 8 >= size)
+        {
+            continue;
+        }
+        auto data = generate_random_data(size, rng);
+        uint64_t raw = dist(rng);
+        auto expected = data;
+        easy_encode(*sig, raw, expected);
+        sig->Encode(raw, &data[0]);
+        REQUIRE(data == expected);
+        REQUIRE(sig->Decode(&data[0], size) == easy_decode(*sig, expected));
+    }
+}
+TEST_CASE("DecodingSized")
+{
+    using namespace dbcppp;
+
+    std::size_t n_tests = 10000;
+    std::size_t max_msg_byte_size = 64;
+
+    uint32_t seed = static_cast<uint32_t>(time(0));
+    std::default_random_engine rng(seed);
+    std::uniform_int_distribution<std::size_t> dist(0, max_msg_byte_size);
+
+    for (std::size_t i = 0; i < n_tests; i++)
+    {
+        auto sig = generate_random_signal(max_msg_byte_size, rng);
+        auto data = generate_random_data(max_msg_byte_size, rng);
+        std::size_t size = dist(rng);
+        // the bytes behind size must be read as zero, so they mustn't be read at all
+        auto truncated = data;
+        std::fill(truncated.begin() + size, truncated.end(), 0);
+        auto expected = easy_decode(*sig, truncated);
+        REQUIRE(sig->Decode(&data[0], size) == expected);
+    }
+}
+template <class Static>
+void check_static_signal(std::default_random_engine& rng)
+{
+    using namespace dbcppp;
+    auto sig = ISignal::Create(64, "Signal", ISignal::EMultiplexer::NoMux, 0, Static::StartBit, Static::BitSize,
+        Static::ByteOrder, Static::ValueType, 1.0, 0.0, 0.0, 0.0, "", {}, {}, {}, "", Static::ExtendedValueType, {});
+    REQUIRE(sig->Error(ISignal::EErrorCode::NoError));
+    std::uniform_int_distribution<uint64_t> dist(0, -1);
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        auto data = generate_random_data(64, rng);
+        REQUIRE(Static::Decode(&data[0]) == sig->Decode(&data[0]));
+        uint64_t raw = dist(rng);
+        auto expected = data;
+        sig->Encode(raw, &expected[0]);
+        Static::Encode(raw, &data[0]);
+        REQUIRE(data == expected);
+    }
+}
+TEST_CASE("StaticSignal")
+{
+    using namespace dbcppp;
+    constexpr auto le = ISignal::EByteOrder::LittleEndian;
+    constexpr auto be = ISignal::EByteOrder::BigEndian;
+    constexpr auto sig = ISignal::EValueType::Signed;
+    constexpr auto usig = ISignal::EValueType::Unsigned;
+
+    uint32_t seed = static_cast<uint32_t>(time(0));
+    std::default_random_engine rng(seed);
+
+    check_static_signal<StaticSignal<0, 8, le, usig>>(rng);
+    check_static_signal<StaticSignal<3, 13, le, sig>>(rng);
+    check_static_signal<StaticSignal<0, 64, le, sig>>(rng);
+    check_static_signal<StaticSignal<100, 20, le, sig>>(rng);
+    check_static_signal<StaticSignal<70, 62, le, usig>>(rng);
+    check_static_signal<StaticSignal<7, 16, be, usig>>(rng);
+    check_static_signal<StaticSignal<2, 12, be, sig>>(rng);
+    check_static_signal<StaticSignal<101, 30, be, sig>>(rng);
+    check_static_signal<StaticSignal<66, 63, be, usig>>(rng);
+    check_static_signal<StaticSignal<32, 32, le, usig, ISignal::EExtendedValueType::Float>>(rng);
+    check_static_signal<StaticSignal<71, 64, be, usig, ISignal::EExtendedValueType::Double>>(rng);
+
+    using Msg = StaticMessage<0x123, 16, StaticSignal<0, 8, le, usig>, StaticSignal<15, 12, be, sig>, StaticSignal<64, 64, le, usig>>;
+    std::array<uint8_t, 16> frame{};
+    Msg::Encode({0xAB, uint64_t(-5), 0x0123456789ABCDEF}, &frame[0]);
+    auto values = Msg::Decode(&frame[0]);
+    REQUIRE(values[0] == 0xAB);
+    REQUIRE(values[1] == uint64_t(-5));
+    REQUIRE(values[2] == 0x0123456789ABCDEF);
+    REQUIRE(Msg::Decode<1>(&frame[0]) == uint64_t(-5));
+}
+auto generate_random_network(
+      std::size_t n_messages
+    , std::size_t max_signals
+    , std::size_t max_msg_byte_size
+    , std::default_random_engine& rng)
+{
+    using namespace dbcppp;
+    std::uniform_int_distribution<std::size_t> dist(1, max_signals);
+    std::vector<std::unique_ptr<IMessage>> messages;
+    for (std::size_t i = 0; i < n_messages; i++)
+    {
+        std::vector<std::unique_ptr<ISignal>> signals;
+        std::size_t n_signals = dist(rng);
+        for (std::size_t j = 0; j < n_signals; j++)
+        {
+            signals.push_back(generate_random_signal(max_msg_byte_size, rng));
+        }
+        messages.push_back(IMessage::Create(i, "Msg" + std::to_string(i), max_msg_byte_size, "", {}, std::move(signals), {}, "", {}));
+    }
+    return INetwork::Create("", {}, IBitTiming::Create(0, 0, 0), {}, {}, std::move(messages), {}, {}, {}, {}, "");
+}
+TEST_CASE("DecodeSignals")
+{
+    using namespace dbcppp;
+
+    std::size_t n_tests = 100;
+
+    uint32_t seed = static_cast<uint32_t>(time(0));
+    std::default_random_engine rng(seed);
+
+    // 8 byte frames put many signals into the same word
+    for (std::size_t max_msg_byte_size : {8, 64})
+    {
+        auto check =
+            [&](const INetwork& net)
+            {
+                for (std::size_t i = 0; i < n_tests; i++)
+                {
+                    auto data = generate_random_data(max_msg_byte_size, rng);
+                    for (const IMessage& msg : net.Messages())
+                    {
+                        std::vector<ISignal::raw_t> values(msg.Signals_Size());
+                        msg.DecodeSignals(&data[0], &values[0]);
+                        for (std::size_t j = 0; j < msg.Signals_Size(); j++)
+                        {
+                            REQUIRE(values[j] == msg.Signals_Get(j).Decode(&data[0]));
+                        }
+                    }
+                }
+            };
+        auto net = generate_random_network(50, 40, max_msg_byte_size, rng);
+        check(*net);
+#if defined(ENABLE_JIT) && (defined(__x86_64__) || defined(_M_X64))
+        REQUIRE(net->CompileJit());
+#else
+        REQUIRE(!net->CompileJit());
+#endif
+        check(*net);
+        // the generated code is shared with copies
+        auto clone = net->Clone();
+        net.reset();
+        check(*clone);
+    }
+}
+TEST_CASE("SignalDescriptors")
+{
+    using namespace dbcppp;
+
+    uint32_t seed = static_cast<uint32_t>(time(0));
+    std::default_random_engine rng(seed);
+
+    auto net = generate_random_network(50, 40, 64, rng);
+    auto clone = net->Clone();
+    for (const INetwork* n : {net.get(), clone.get()})
+    {
+        for (std::size_t i = 0; i < 100; i++)
+        {
+            auto data = generate_random_data(64, rng);
+            for (const IMessage& msg : n->Messages())
+            {
+                const ISignal::Descriptor* descs = msg.SignalDescriptors();
+                for (std::size_t j = 0; j < msg.Signals_Size(); j++)
+                {
+                    REQUIRE(descs[j].Decode(&data[0]) == msg.Signals_Get(j).Decode(&data[0]));
+                }
+            }
+        }
+    }
+}
+TEST_CASE("DecodeColumns")
+{
+    using namespace dbcppp;
+
+    uint32_t seed = static_cast<uint32_t>(time(0));
+    std::default_random_engine rng(seed);
+
+    // Switch selects which of Value1/Value2 is present, Plain is always present
+    auto make_signal =
+        [](std::string name, ISignal::EMultiplexer mux, uint64_t switch_value, uint64_t start_bit, uint64_t bit_size, ISignal::EValueType value_type)
+        {
+            return ISignal::Create(8, std::move(name), mux, switch_value, start_bit, bit_size, ISignal::EByteOrder::LittleEndian,
+                value_type, 0.5, -3.0, 0.0, 0.0, "", {}, {}, {}, "", ISignal::EExtendedValueType::Integer, {});
+        };
+    std::vector<std::unique_ptr<ISignal>> signals;
+    signals.push_back(make_signal("Switch", ISignal::EMultiplexer::MuxSwitch, 0, 0, 2, ISignal::EValueType::Unsigned));
+    signals.push_back(make_signal("Value1", ISignal::EMultiplexer::MuxValue, 1, 8, 12, ISignal::EValueType::Signed));
+    signals.push_back(make_signal("Value2", ISignal::EMultiplexer::MuxValue, 2, 8, 16, ISignal::EValueType::Unsigned));
+    signals.push_back(make_signal("Plain", ISignal::EMultiplexer::NoMux, 0, 24, 40, ISignal::EValueType::Unsigned));
+    auto msg = IMessage::Create(1, "Msg", 8, "", {}, std::move(signals), {}, "", {});
+
+    // not a multiple of the internal chunk size nor of 8
+    constexpr std::size_t n = 1003;
+    constexpr std::size_t frame_stride = 16;
+    std::vector<uint8_t> frames(n * frame_stride);
+    std::uniform_int_distribution<uint32_t> dist(0, 255);
+    for (auto& b : frames)
+    {
+        b = uint8_t(dist(rng));
+    }
+
+    struct Row
+    {
+        double value1;
+        uint32_t padding;
+        double plain;
+    };
+    std::vector<ISignal::raw_t> switch_raw(n);
+    std::vector<double> value2(n);
+    std::vector<Row> rows(n);
+    std::vector<uint8_t> switch_valid((n + 7) / 8), value1_valid((n + 7) / 8), value2_valid((n + 7) / 8);
+    const IMessage::Column columns[] =
+    {
+          {0, switch_raw.data(), 0, false, switch_valid.data()}
+        , {1, &rows[0].value1, sizeof(Row), true, value1_valid.data()}
+        , {2, value2.data(), 0, true, value2_valid.data()}
+        , {3, &rows[0].plain, sizeof(Row), true, nullptr}
+    };
+    msg->DecodeColumns(frames.data(), frame_stride, n, columns, 4);
+
+    auto valid = [](const std::vector<uint8_t>& bitmap, std::size_t i) { return ((bitmap[i / 8] >> (i % 8)) & 1) != 0; };
+    const ISignal& sw = msg->Signals_Get(0);
+    const ISignal& v1 = msg->Signals_Get(1);
+    const ISignal& v2 = msg->Signals_Get(2);
+    const ISignal& plain = msg->Signals_Get(3);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        const uint8_t* frame = &frames[i * frame_stride];
+        auto mux = sw.Decode(frame);
+        REQUIRE(switch_raw[i] == mux);
+        REQUIRE(valid(switch_valid, i));
+        REQUIRE(rows[i].value1 == v1.RawToPhys(v1.Decode(frame)));
+        REQUIRE(valid(value1_valid, i) == (mux == 1));
+        REQUIRE(value2[i] == v2.RawToPhys(v2.Decode(frame)));
+        REQUIRE(valid(value2_valid, i) == (mux == 2));
+        REQUIRE(rows[i].plain == plain.RawToPhys(plain.Decode(frame)));
+    }
+    // bits behind the last frame are cleared
+    REQUIRE((switch_valid.back() >> (n % 8)) == 0);
+}
+TEST_CASE("RawToPhysLUT")
+{
+    using namespace dbcppp;
+
+    uint32_t seed = static_cast<uint32_t>(time(0));
+    std::default_random_engine rng(seed);
+    std::uniform_int_distribution<uint64_t> dist(0, std::numeric_limits<uint64_t>::max());
+
+    auto create =
+        [](uint64_t bit_size, ISignal::EValueType value_type, double factor, double offset)
+        {
+            return ISignal::Create(8, "Signal", ISignal::EMultiplexer::NoMux, 0, 3, bit_size, ISignal::EByteOrder::LittleEndian,
+                value_type, factor, offset, 0.0, 0.0, "", {}, {}, {}, "", ISignal::EExtendedValueType::Integer, {});
+        };
+    REQUIRE(ISignal::RawToPhysLUTMemory() == 0);
+    for (uint64_t bit_size = 1; bit_size <= 14; bit_size++)
+    {
+        for (auto value_type : {ISignal::EValueType::Signed, ISignal::EValueType::Unsigned})
+        {
+            ISignal::SetRawToPhysLUT(12, 1 << 20);
+            auto lut = create(bit_size, value_type, 0.1, -40.0);
+            // tables are only used up to the threshold
+            REQUIRE((ISignal::RawToPhysLUTMemory() != 0) == (bit_size <= 12));
+            ISignal::SetRawToPhysLUT(0, 0);
+            auto conv = create(bit_size, value_type, 0.1, -40.0);
+            std::vector<uint8_t> data(8);
+            std::vector<ISignal::raw_t> raws;
+            for (std::size_t i = 0; i < 100; i++)
+            {
+                uint64_t rnd = dist(rng);
+                std::memcpy(&data[0], &rnd, 8);
+                raws.push_back(lut->Decode(&data[0]));
+                REQUIRE(lut->RawToPhys(raws.back()) == conv->RawToPhys(raws.back()));
+            }
+            std::vector<double> lut_phys(raws.size()), conv_phys(raws.size());
+            lut->RawToPhysBatch(&raws[0], &lut_phys[0], raws.size());
+            conv->RawToPhysBatch(&raws[0], &conv_phys[0], raws.size());
+            REQUIRE(lut_phys == conv_phys);
+            // copies share the table
+            auto clone = lut->Clone();
+            REQUIRE(clone->RawToPhys(raws[0]) == conv->RawToPhys(raws[0]));
+            std::size_t memory = ISignal::RawToPhysLUTMemory();
+            lut.reset();
+            REQUIRE(ISignal::RawToPhysLUTMemory() == memory);
+            clone.reset();
+            REQUIRE(ISignal::RawToPhysLUTMemory() == 0);
+        }
+    }
+    // tables beyond the memory budget aren't created
+    ISignal::SetRawToPhysLUT(8, 256 * sizeof(double));
+    auto first = create(8, ISignal::EValueType::Unsigned, 2.0, 1.0);
+    auto second = create(8, ISignal::EValueType::Unsigned, 2.0, 1.0);
+    REQUIRE(ISignal::RawToPhysLUTMemory() == 256 * sizeof(double));
+    REQUIRE(first->RawToPhys(255) == 511.0);
+    REQUIRE(second->RawToPhys(255) == 511.0);
+    ISignal::SetRawToPhysLUT(0, 0);
+}
+TEST_CASE("DecodeMessage")
+{
+    using namespace dbcppp;
+
+    uint32_t seed = static_cast<uint32_t>(time(0));
+    std::default_random_engine rng(seed);
+    std::uniform_int_distribution<uint64_t> dist(0, 15);
+
+    // small switch values use the dense table, large ones the sorted table
+    for (uint64_t switch_base : {uint64_t(0), uint64_t(1000)})
+    {
+        std::vector<std::unique_ptr<ISignal>> signals;
+        signals.push_back(ISignal::Create(8, "Switch", ISignal::EMultiplexer::MuxSwitch, 0, 0, 16, ISignal::EByteOrder::LittleEndian,
+            ISignal::EValueType::Unsigned, 1.0, 0.0, 0.0, 0.0, "", {}, {}, {}, "", ISignal::EExtendedValueType::Integer, {}));
+        for (std::size_t i = 0; i < 40; i++)
+        {
+            auto mux = i % 3 == 0 ? ISignal::EMultiplexer::NoMux : ISignal::EMultiplexer::MuxValue;
+            signals.push_back(ISignal::Create(8, "Signal" + std::to_string(i), mux, switch_base + dist(rng) % 8, 16 + dist(rng) * 3, 1 + dist(rng),
+                ISignal::EByteOrder::LittleEndian, ISignal::EValueType::Unsigned, 1.0, 0.0, 0.0, 0.0, "", {}, {}, {}, "",
+                ISignal::EExtendedValueType::Integer, {}));
+        }
+        auto msg = IMessage::Create(1, "Msg", 8, "", {}, std::move(signals), {}, "", {});
+        for (std::size_t i = 0; i < 1000; i++)
+        {
+            auto data = generate_random_data(8, rng);
+            // hit the multiplexed values most of the time
+            uint16_t switch_value = uint16_t(switch_base + dist(rng) % 10);
+            std::memcpy(&data[0], &switch_value, 2);
+            IMessage::DecodeResult result;
+            msg->Decode(&data[0], result);
+            std::vector<IMessage::DecodeResult::Entry> expected;
+            for (uint32_t j = 0; j < msg->Signals_Size(); j++)
+            {
+                const ISignal& sig = msg->Signals_Get(j);
+                if (sig.MultiplexerIndicator() != ISignal::EMultiplexer::MuxValue ||
+                    sig.MultiplexerSwitchValue() == switch_value)
+                {
+                    expected.push_back({j, sig.Decode(&data[0])});
+                }
+            }
+            REQUIRE(!result.Overflow());
+            REQUIRE(result.Size() == expected.size());
+            for (std::size_t j = 0; j < expected.size(); j++)
+            {
+                REQUIRE(result[j].signal == expected[j].signal);
+                REQUIRE(result[j].raw == expected[j].raw);
+            }
+        }
+    }
+}
+TEST_CASE("DecodeMessageExtendedMux")
+{
+    using namespace dbcppp;
+
+    uint32_t seed = static_cast<uint32_t>(time(0));
+    std::default_random_engine rng(seed);
+    std::uniform_int_distribution<uint32_t> dist(0, 5);
+
+    // reference: a signal is present if all of its switches are present and have one of the listed values
+    std::function<bool(const IMessage&, const ISignal&, const uint8_t*)> present =
+        [&](const IMessage& msg, const ISignal& sig, const uint8_t* data) -> bool
+        {
+            if (sig.MultiplexerIndicator() != ISignal::EMultiplexer::MuxValue)
+            {
+                return true;
+            }
+            if (sig.SignalMultiplexerValues_Size() == 0)
+            {
+                return msg.MuxSignal() && msg.MuxSignal()->Decode(data) == sig.MultiplexerSwitchValue();
+            }
+            for (const auto& smv : sig.SignalMultiplexerValues())
+            {
+                const ISignal* sw = nullptr;
+                for (const ISignal& s : msg.Signals())
+                {
+                    if (s.Name() == smv.SwitchName())
+                    {
+                        sw = &s;
+                        break;
+                    }
+                }
+                if (!sw || !present(msg, *sw, data))
+                {
+                    return false;
+                }
+                auto raw = sw->Decode(data);
+                bool in_range = false;
+                for (const auto& range : smv.ValueRanges())
+                {
+                    in_range |= raw >= range.from && raw <= range.to;
+                }
+                if (!in_range)
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+    for (const char* file : {"issue_184_extended_mux_cascaded.dbc", "issue_184_extended_mux_independent_multiplexors.dbc",
+        "issue_184_extended_mux_multiple_values.dbc"})
+    {
+        std::ifstream is(std::string(TEST_FILES_PATH) + "/dbc/" + file);
+        auto net = INetwork::LoadDBCFromIs(is);
+        REQUIRE(net);
+        for (const IMessage& msg : net->Messages())
+        {
+            constexpr std::size_t n = 500;
+            std::vector<uint8_t> frames(n * 8);
+            // small values so the switches select something
+            for (auto& b : frames)
+            {
+                b = uint8_t(dist(rng));
+            }
+            std::vector<std::vector<uint8_t>> validity(msg.Signals_Size(), std::vector<uint8_t>((n + 7) / 8));
+            std::vector<std::vector<ISignal::raw_t>> values(msg.Signals_Size(), std::vector<ISignal::raw_t>(n));
+            std::vector<IMessage::Column> columns;
+            for (std::size_t i = 0; i < msg.Signals_Size(); i++)
+            {
+                columns.push_back({i, values[i].data(), 0, false, validity[i].data()});
+            }
+            msg.DecodeColumns(frames.data(), 8, n, columns.data(), columns.size());
+            for (std::size_t f = 0; f < n; f++)
+            {
+                const uint8_t* data = &frames[f * 8];
+                IMessage::DecodeResult result;
+                msg.Decode(data, result);
+                std::size_t k = 0;
+                for (uint32_t i = 0; i < msg.Signals_Size(); i++)
+                {
+                    const ISignal& sig = msg.Signals_Get(i);
+                    bool expected = present(msg, sig, data);
+                    REQUIRE(((validity[i][f / 8] >> (f % 8)) & 1) == expected);
+                    if (expected)
+                    {
+                        REQUIRE(k < result.Size());
+                        REQUIRE(result[k].signal == i);
+                        REQUIRE(result[k].raw == sig.Decode(data));
+                        k++;
+                    }
+                }
+                REQUIRE(k == result.Size());
+            }
+        }
+    }
+}
+TEST_CASE("DecodeMessageSized")
+{
+    using namespace dbcppp;
+
+    uint32_t seed = static_cast<uint32_t>(time(0));
+    std::default_random_engine rng(seed);
+
+    // a sized decode must match the unchecked decode of the frame padded with zeros
+    auto check =
+        [&](const IMessage& msg, const std::vector<uint8_t>& data)
+        {
+            std::size_t frame_size = std::max<std::size_t>(msg.MessageSize(), 8);
+            for (std::size_t size = 0; size <= frame_size; size++)
+            {
+                // exactly size bytes, so nothing behind them is readable
+                std::unique_ptr<uint8_t[]> exact(new uint8_t[size]);
+                std::memcpy(exact.get(), data.data(), size);
+                std::vector<uint8_t> padded(frame_size + 8, 0);
+                std::memcpy(padded.data(), data.data(), size);
+                IMessage::DecodeResult result;
+                IMessage::DecodeResult expected;
+                msg.Decode(exact.get(), size, result);
+                msg.Decode(padded.data(), expected);
+                REQUIRE(result.Size() == expected.Size());
+                for (std::size_t i = 0; i < expected.Size(); i++)
+                {
+                    REQUIRE(result[i].signal == expected[i].signal);
+                    REQUIRE(result[i].raw == expected[i].raw);
+                }
+            }
+        };
+
+    auto net = generate_random_network(10, 20, 64, rng);
+    for (const IMessage& msg : net->Messages())
+    {
+        check(msg, generate_random_data(64, rng));
+    }
+    // CAN FD message with the switch behind the first 8 bytes
+    std::vector<std::unique_ptr<ISignal>> signals;
+    signals.push_back(ISignal::Create(16, "Switch", ISignal::EMultiplexer::MuxSwitch, 0, 80, 8, ISignal::EByteOrder::LittleEndian,
+        ISignal::EValueType::Unsigned, 1.0, 0.0, 0.0, 0.0, "", {}, {}, {}, "", ISignal::EExtendedValueType::Integer, {}));
+    for (uint64_t i = 0; i < 4; i++)
+    {
+        signals.push_back(ISignal::Create(16, "Signal" + std::to_string(i), ISignal::EMultiplexer::MuxValue, i, 88 + i * 8, 8,
+            ISignal::EByteOrder::BigEndian, ISignal::EValueType::Signed, 1.0, 0.0, 0.0, 0.0, "", {}, {}, {}, "",
+            ISignal::EExtendedValueType::Integer, {}));
+    }
+    auto mux_msg = IMessage::Create(1, "Msg", 16, "", {}, std::move(signals), {}, "", {});
+    for (uint8_t switch_value = 0; switch_value < 4; switch_value++)
+    {
+        auto data = generate_random_data(16, rng);
+        data[10] = switch_value;
+        check(*mux_msg, data);
+    }
+    std::ifstream is(std::string(TEST_FILES_PATH) + "/dbc/issue_184_extended_mux_cascaded.dbc");
+    auto mux_net = INetwork::LoadDBCFromIs(is);
+    REQUIRE(mux_net);
+    std::uniform_int_distribution<uint32_t> dist(0, 5);
+    for (const IMessage& msg : mux_net->Messages())
+    {
+        for (std::size_t i = 0; i < 20; i++)
+        {
+            std::vector<uint8_t> data(8);
+            for (auto& b : data)
+            {
+                b = uint8_t(dist(rng));
+            }
+            check(msg, data);
+        }
+    }
+}
+TEST_CASE("DecodeChanges")
+{
+    using namespace dbcppp;
+
+    uint32_t seed = static_cast<uint32_t>(time(0));
+    std::default_random_engine rng(seed);
+    std::uniform_int_distribution<uint32_t> dist(0, 1000);
+
+    // flips a few bits or none, so most frames repeat the previous one
+    auto mutate =
+        [&](std::vector<uint8_t>& data, std::size_t size)
+        {
+            for (std::size_t n = dist(rng) % 4; n > 0; n--)
+            {
+                std::size_t bit = dist(rng) % (size * 8);
+                data[bit / 8] ^= uint8_t(1 << (bit % 8));
+            }
+        };
+    // without multiplexing exactly the signals whose value changed are reported
+    for (std::size_t max_msg_byte_size : {8, 64})
+    {
+        auto net = generate_random_network(20, 40, max_msg_byte_size, rng);
+        for (const IMessage& msg : net->Messages())
+        {
+            IMessage::ChangeState state;
+            IMessage::DecodeResult result;
+            auto data = generate_random_data(max_msg_byte_size, rng);
+            msg.DecodeChanges(&data[0], state, result);
+            REQUIRE(state.Valid());
+            REQUIRE(result.Size() == msg.Signals_Size());
+            for (std::size_t i = 0; i < 100; i++)
+            {
+                auto next = data;
+                mutate(next, max_msg_byte_size);
+                msg.DecodeChanges(&next[0], state, result);
+                std::size_t k = 0;
+                for (uint32_t j = 0; j < msg.Signals_Size(); j++)
+                {
+                    const ISignal& sig = msg.Signals_Get(j);
+                    if (sig.Decode(&next[0]) != sig.Decode(&data[0]))
+                    {
+                        REQUIRE(k < result.Size());
+                        REQUIRE(result[k].signal == j);
+                        REQUIRE(result[k].raw == sig.Decode(&next[0]));
+                        k++;
+                    }
+                }
+                REQUIRE(k == result.Size());
+                data = next;
+            }
+            state.Reset();
+            msg.DecodeChanges(&data[0], state, result);
+            REQUIRE(result.Size() == msg.Signals_Size());
+        }
+    }
+    // with multiplexing a signal is reported if it changed or just became present,
+    // it may also be reported if only one of its switches changed
+    for (const char* file : {"issue_184_extended_mux_cascaded.dbc", "issue_184_extended_mux_independent_multiplexors.dbc",
+        "issue_184_extended_mux_multiple_values.dbc"})
+    {
+        std::ifstream is(std::string(TEST_FILES_PATH) + "/dbc/" + file);
+        auto net = INetwork::LoadDBCFromIs(is);
+        REQUIRE(net);
+        for (const IMessage& msg : net->Messages())
+        {
+            IMessage::ChangeState state;
+            std::vector<uint8_t> data(8);
+            std::map<uint32_t, ISignal::raw_t> previous;
+            for (std::size_t i = 0; i < 500; i++)
+            {
+                auto next = data;
+                // small switch values so they select something
+                next[dist(rng) % 8] = uint8_t(dist(rng) % 6);
+                IMessage::DecodeResult full;
+                msg.Decode(&next[0], full);
+                IMessage::DecodeResult changes;
+                msg.DecodeChanges(&next[0], state, changes);
+                std::map<uint32_t, ISignal::raw_t> current;
+                for (const auto& entry : full)
+                {
+                    current[entry.signal] = entry.raw;
+                }
+                std::map<uint32_t, ISignal::raw_t> reported;
+                for (const auto& entry : changes)
+                {
+                    REQUIRE(current.count(entry.signal));
+                    REQUIRE(current[entry.signal] == entry.raw);
+                    reported[entry.signal] = entry.raw;
+                }
+                for (const auto& entry : current)
+                {
+                    auto iter = previous.find(entry.first);
+                    if (i == 0 || iter == previous.end() || iter->second != entry.second)
+                    {
+                        REQUIRE(reported.count(entry.first));
+                    }
+                }
+                if (next == data && i != 0)
+                {
+                    REQUIRE(changes.Size() == 0);
+                }
+                previous = current;
+                data = next;
+            }
+        }
+    }
+}
+TEST_CASE("DecodeCache")
+{
+    using namespace dbcppp;
+
+    uint32_t seed = static_cast<uint32_t>(time(0));
+    std::default_random_engine rng(seed);
+
+    constexpr const char* test_dbc =
+        "VERSION \"\"\n"
+        "NS_ :\n"
+        "BS_:\n"
+        "BU_:\n"
+        "BO_ 1 Msg: 8 Vector__XXX\n"
+        " SG_ Mux M : 0|2@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ A m1 : 8|8@1+ (0.5,1) [0|0] \"\" Vector__XXX\n"
+        " SG_ B m2 : 8|8@1- (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ C : 16|2@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        "BO_ 2 Other: 8 Vector__XXX\n"
+        " SG_ D : 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        "VAL_ 1 C 0 \"Off\" 1 \"On\" 2 \"Error\" ;\n";
+    std::istringstream iss(test_dbc);
+    auto net = INetwork::LoadDBCFromIs(iss);
+    REQUIRE(net);
+    auto check =
+        [](const IMessage& msg, const uint8_t* data, const IDecodeCache::Values& values)
+        {
+            IMessage::DecodeResult expected;
+            msg.Decode(data, expected);
+            REQUIRE(values.Size() == expected.Size());
+            for (std::size_t i = 0; i < expected.Size(); i++)
+            {
+                const ISignal& sig = msg.Signals_Get(expected[i].signal);
+                REQUIRE(values[i].signal == expected[i].signal);
+                REQUIRE(values[i].raw == expected[i].raw);
+                REQUIRE(values[i].physical == sig.RawToPhys(expected[i].raw));
+                REQUIRE(values[i].description == sig.ValueToDescription(int64_t(expected[i].raw)));
+            }
+        };
+
+    // a few distinct payloads, the same payload of another message is another entry
+    std::vector<std::array<uint8_t, 8>> payloads;
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        payloads.push_back({i, uint8_t(i * 31), uint8_t(i % 3), 0, 0, 0, 0, 0});
+    }
+    auto cache = IDecodeCache::Create(16);
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        const IMessage& msg = net->Messages_Get(i % 2);
+        const auto& data = payloads[rng() % payloads.size()];
+        check(msg, data.data(), cache->Decode(msg, data.data()));
+    }
+    REQUIRE(cache->Size() == 16);
+    REQUIRE(cache->Misses() == 16);
+    REQUIRE(cache->Hits() == 1000 - 16);
+    const IMessage& msg = net->Messages_Get(0);
+    auto values = cache->Decode(msg, payloads[1].data());
+    REQUIRE(values.Size() == 3);
+    REQUIRE(*values[2].description == "On");
+
+    // more distinct payloads than entries, the entries are evicted and the results stay correct
+    cache = IDecodeCache::Create(5);
+    for (std::size_t i = 0; i < 2000; i++)
+    {
+        auto data = generate_random_data(8, rng);
+        // mostly a few hot payloads
+        if (rng() % 4 != 0)
+        {
+            std::memcpy(&data[0], payloads[rng() % 3].data(), 8);
+        }
+        check(msg, &data[0], cache->Decode(msg, &data[0]));
+        REQUIRE(cache->Size() <= 5);
+    }
+    REQUIRE(cache->Hits() + cache->Misses() == 2000);
+    REQUIRE(cache->Hits() > 1000);
+    cache->Clear();
+    REQUIRE(cache->Size() == 0);
+    REQUIRE(cache->Hits() == 0);
+}
+TEST_CASE("SignalGroup")
+{
+    using namespace dbcppp;
+
+    uint32_t seed = static_cast<uint32_t>(time(0));
+    std::default_random_engine rng(seed);
+
+    for (std::size_t max_msg_byte_size : {8, 64})
+    {
+        std::vector<std::unique_ptr<ISignal>> signals;
+        std::vector<std::string> names;
+        for (std::size_t i = 0; i < 40; i++)
+        {
+            auto sig = generate_random_signal(max_msg_byte_size, rng);
+            std::string name = "Signal" + std::to_string(i);
+            signals.push_back(ISignal::Create(max_msg_byte_size, std::string(name), ISignal::EMultiplexer::NoMux, 0, sig->StartBit(),
+                sig->BitSize(), sig->ByteOrder(), sig->ValueType(), 1.0, 0.0, 0.0, 0.0, "", {}, {}, {}, "",
+                sig->ExtendedValueType(), {}));
+            if (i % 3 == 0)
+            {
+                names.push_back(name);
+            }
+        }
+        std::shuffle(names.begin(), names.end(), rng);
+        names.push_back("Unknown");
+        std::vector<std::unique_ptr<ISignalGroup>> groups;
+        groups.push_back(ISignalGroup::Create(1, "Group", 1, std::vector<std::string>(names)));
+        auto msg = IMessage::Create(1, "Msg", max_msg_byte_size, "", {}, std::move(signals), {}, "", std::move(groups))->Clone();
+        REQUIRE(msg->SignalGroups_Size() == 1);
+        const ISignalGroup& group = msg->SignalGroups_Get(0);
+        auto find =
+            [&](const std::string& name) -> const ISignal*
+            {
+                for (const ISignal& sig : msg->Signals())
+                {
+                    if (sig.Name() == name)
+                    {
+                        return &sig;
+                    }
+                }
+                return nullptr;
+            };
+        for (std::size_t i = 0; i < 100; i++)
+        {
+            auto data = generate_random_data(max_msg_byte_size, rng);
+            std::vector<ISignal::raw_t> record(group.SignalNames_Size(), 1);
+            msg->DecodeSignalGroup(0, &data[0], record.data());
+            for (std::size_t j = 0; j < group.SignalNames_Size(); j++)
+            {
+                const ISignal* sig = find(group.SignalNames_Get(j));
+                REQUIRE(record[j] == (sig ? sig->Decode(&data[0]) : 0));
+            }
+        }
+        // the group can't be encoded because of the unknown signal
+        std::vector<uint8_t> frame(max_msg_byte_size);
+        std::vector<ISignal::raw_t> record(group.SignalNames_Size());
+        REQUIRE(msg->EncodeSignalGroup(0, record.data(), &frame[0], frame.size()) == IMessage::EEncodeError::InvalidSignal);
+    }
+
+    constexpr const char* test_dbc =
+        "VERSION \"\"\n"
+        "NS_ :\n"
+        "BS_:\n"
+        "BU_:\n"
+        "BO_ 1 Msg: 8 Vector__XXX\n"
+        " SG_ A : 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ B : 15|12@0- (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ C : 32|16@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ D : 48|16@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        "SIG_GROUP_ 1 Group 1 : C B;\n";
+    std::istringstream iss(test_dbc);
+    auto net = INetwork::LoadDBCFromIs(iss);
+    REQUIRE(net);
+    const IMessage& msg = net->Messages_Get(0);
+    REQUIRE(msg.SignalGroups_Size() == 1);
+    uint8_t frame[8] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+    uint8_t expected[8];
+    std::memcpy(expected, frame, 8);
+    msg.Signals_Get(2).Encode(1234, expected);
+    msg.Signals_Get(1).Encode(ISignal::raw_t(-5), expected);
+    ISignal::raw_t record[] = {1234, ISignal::raw_t(-5)};
+    REQUIRE(msg.EncodeSignalGroup(0, record, frame, 8) == IMessage::EEncodeError::NoError);
+    REQUIRE(std::memcmp(frame, expected, 8) == 0);
+    ISignal::raw_t decoded[2];
+    msg.DecodeSignalGroup(0, frame, decoded);
+    REQUIRE(decoded[0] == 1234);
+    REQUIRE(decoded[1] == ISignal::raw_t(-5));
+    REQUIRE(msg.EncodeSignalGroup(0, record, frame, 7) == IMessage::EEncodeError::BufferTooSmall);
+}
+TEST_CASE("MessageView")
+{
+    using namespace dbcppp;
+
+    static_assert(std::is_trivially_copyable_v<MessageView>);
+    static_assert(std::is_trivially_copyable_v<BasicMessageView<64>>);
+
+    uint32_t seed = static_cast<uint32_t>(time(0));
+    std::default_random_engine rng(seed);
+
+    auto net = generate_random_network(10, 40, 64, rng);
+    for (const IMessage& msg : net->Messages())
+    {
+        auto data = generate_random_data(64, rng);
+        auto other = generate_random_data(64, rng);
+        BasicMessageView<4> view(msg, &data[0], data.size());
+        // the indices collide in the cache, so the values are evicted and decoded again
+        for (std::size_t i = 0; i < 200; i++)
+        {
+            std::size_t j = rng() % msg.Signals_Size();
+            const ISignal& sig = msg.Signals_Get(j);
+            REQUIRE(view.Raw(j) == sig.Decode(&data[0]));
+            // since nan != nan the bits are compared
+            double phys = view.Phys(j);
+            double expected = sig.RawToPhys(sig.Decode(&data[0]));
+            REQUIRE(std::memcmp(&phys, &expected, sizeof(double)) == 0);
+        }
+        // copies are independent
+        auto copy = view;
+        copy.Reset(&other[0], other.size());
+        for (std::size_t j = 0; j < msg.Signals_Size(); j++)
+        {
+            REQUIRE(copy.Raw(j) == msg.Signals_Get(j).Decode(&other[0]));
+            REQUIRE(view.Raw(j) == msg.Signals_Get(j).Decode(&data[0]));
+        }
+        auto handle = MessageView::Resolve(msg, msg.Signals_Get(msg.Signals_Size() - 1).Name());
+        REQUIRE(handle);
+        MessageView v(msg, &data[0], data.size());
+        REQUIRE(v.Raw(*handle) == msg.Signals_Get(handle->index).Decode(&data[0]));
+        REQUIRE(!MessageView::Resolve(msg, "NoSuchSignal"));
+        // short payloads aren't read behind their end
+        for (std::size_t length : {std::size_t(0), std::size_t(3), std::size_t(8), std::size_t(20)})
+        {
+            std::unique_ptr<uint8_t[]> payload(new uint8_t[length]);
+            std::memcpy(payload.get(), &data[0], length);
+            MessageView short_view(msg, payload.get(), length);
+            for (std::size_t j = 0; j < msg.Signals_Size(); j++)
+            {
+                REQUIRE(short_view.Raw(j) == msg.Signals_Get(j).Decode(&data[0], length));
+            }
+        }
+    }
+}
+TEST_CASE("FrameBuilder")
+{
+    using namespace dbcppp;
+
+    uint32_t seed = static_cast<uint32_t>(time(0));
+    std::default_random_engine rng(seed);
+
+    // the builder's frame always equals a frame encoded from scratch with the same values
+    auto net = generate_random_network(10, 40, 64, rng);
+    for (const IMessage& msg : net->Messages())
+    {
+        auto builder = IFrameBuilder::Create(msg);
+        REQUIRE(builder->Size() == 64);
+        std::vector<uint8_t> expected(builder->Data(), builder->Data() + builder->Size());
+        for (std::size_t i = 0; i < 100; i++)
+        {
+            auto before = expected;
+            // the random signals overlap, so each signal is set at most once to keep the order of the encodes
+            std::vector<std::size_t> set;
+            for (std::size_t n = rng() % 4; n > 0; n--)
+            {
+                std::size_t j = rng() % msg.Signals_Size();
+                if (std::find(set.begin(), set.end(), j) != set.end())
+                {
+                    continue;
+                }
+                set.push_back(j);
+                ISignal::raw_t raw = rng();
+                REQUIRE(builder->Set(j, raw) == IMessage::EEncodeError::NoError);
+                msg.Signals_Get(j).Encode(raw, &expected[0]);
+            }
+            uint64_t touched = builder->Flush();
+            REQUIRE(std::equal(expected.begin(), expected.end(), builder->Data()));
+            for (std::size_t w = 0; w < 8; w++)
+            {
+                if (!((touched >> w) & 1))
+                {
+                    REQUIRE(std::equal(&before[w * 8], &before[w * 8 + 8], &expected[w * 8]));
+                }
+            }
+        }
+        REQUIRE(builder->Flush() == 0);
+        REQUIRE(builder->Set(msg.Signals_Size(), 0) == IMessage::EEncodeError::InvalidSignal);
+    }
+
+    constexpr const char* test_dbc =
+        "VERSION \"\"\n"
+        "NS_ :\n"
+        "BS_:\n"
+        "BU_:\n"
+        "BO_ 1 Msg: 16 Vector__XXX\n"
+        " SG_ A : 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ B : 60|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ C : 71|8@0+ (1,0) [0|0] \"\" Vector__XXX\n"
+        "BA_DEF_ SG_ \"GenSigStartValue\" INT 0 10000;\n"
+        "BA_ \"GenSigStartValue\" SG_ 1 C 42;\n";
+    std::istringstream iss(test_dbc);
+    auto dbc = INetwork::LoadDBCFromIs(iss);
+    REQUIRE(dbc);
+    const IMessage& msg = dbc->Messages_Get(0);
+    auto builder = IFrameBuilder::Create(msg);
+    REQUIRE(builder->Data()[8] == 42);
+    // the last value wins
+    builder->Set(0, 1);
+    builder->Set(0, 2);
+    REQUIRE(builder->Data()[0] == 0);
+    REQUIRE(builder->Flush() == 0b01);
+    REQUIRE(builder->Data()[0] == 2);
+    // B straddles the words
+    builder->Set(1, 0xFF);
+    REQUIRE(builder->Flush() == 0b11);
+    builder->Set(2, 7);
+    REQUIRE(builder->Flush() == 0b10);
+    REQUIRE(builder->Data()[8] == 7);
+}
+TEST_CASE("Projection")
+{
+    using namespace dbcppp;
+
+    uint32_t seed = static_cast<uint32_t>(time(0));
+    std::default_random_engine rng(seed);
+
+    // reference: Decode of the whole message filtered by the projected signals
+    auto check =
+        [&](const INetwork& net, const IProjection& projection, const IMessage& msg, const uint8_t* data)
+        {
+            std::vector<IProjection::Value> values(projection.MaxValues());
+            std::size_t n = projection.Decode(msg.Id(), data, values.data());
+            IMessage::DecodeResult result;
+            msg.Decode(data, result);
+            std::size_t k = 0;
+            for (const auto& entry : result)
+            {
+                for (std::size_t c = 0; c < projection.Columns_Size(); c++)
+                {
+                    if (&projection.Columns_Get(c) == &msg.Signals_Get(entry.signal))
+                    {
+                        REQUIRE(k < n);
+                        REQUIRE(values[k].column == c);
+                        REQUIRE(values[k].raw == entry.raw);
+                        k++;
+                    }
+                }
+            }
+            REQUIRE(k == n);
+            REQUIRE(projection.Covers(msg.Id()) == std::any_of(projection.Columns().begin(), projection.Columns().end(),
+                [&](const ISignal& sig) { return net.ParentMessage(&sig) == &msg; }));
+        };
+    auto net = generate_random_network(100, 40, 64, rng);
+    std::vector<const ISignal*> signals;
+    for (const IMessage& msg : net->Messages())
+    {
+        for (const ISignal& sig : msg.Signals())
+        {
+            if (rng() % 50 == 0)
+            {
+                signals.push_back(&sig);
+            }
+        }
+    }
+    auto projection = IProjection::Create(*net, signals);
+    REQUIRE(projection->Columns_Size() == signals.size());
+    for (std::size_t i = 0; i < signals.size(); i++)
+    {
+        REQUIRE(&projection->Columns_Get(i) == signals[i]);
+        REQUIRE(&projection->ColumnMessage(i) == net->ParentMessage(signals[i]));
+    }
+    for (const IMessage& msg : net->Messages())
+    {
+        auto data = generate_random_data(64, rng);
+        check(*net, *projection, msg, &data[0]);
+    }
+    REQUIRE(!projection->Covers(100000));
+    REQUIRE(projection->Decode(100000, nullptr, nullptr) == 0);
+
+    // frames are decoded as the first message with their id
+    {
+        constexpr const char* dup_dbc =
+            "VERSION \"\"\n"
+            "NS_ :\n"
+            "BS_:\n"
+            "BU_:\n"
+            "BO_ 1 Msg0: 8 Vector__XXX\n"
+            "  SG_ Sig0 : 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+            "BO_ 1 Msg1: 8 Vector__XXX\n"
+            "  SG_ Sig1 : 8|8@1+ (1,0) [0|0] \"\" Vector__XXX\n";
+        std::istringstream iss(dup_dbc);
+        auto dup_net = INetwork::LoadDBCFromIs(iss);
+        REQUIRE(dup_net);
+        uint8_t data[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+        IProjection::Value values[2];
+        auto later_only = IProjection::Create(*dup_net, std::vector<std::string>{"Sig1"});
+        REQUIRE(later_only->Columns_Size() == 1);
+        REQUIRE(!later_only->Covers(1));
+        REQUIRE(later_only->Decode(1, data, values) == 0);
+        auto both = IProjection::Create(*dup_net, std::vector<std::string>{"Sig1", "Sig0"});
+        REQUIRE(both->Covers(1));
+        REQUIRE(both->Decode(1, data, values) == 1);
+        REQUIRE(values[0].column == 1);
+        REQUIRE(values[0].raw == 1);
+    }
+
+    // by name and with multiplexing
+    std::uniform_int_distribution<uint32_t> dist(0, 5);
+    for (const char* file : {"issue_184_extended_mux_cascaded.dbc", "issue_184_extended_mux_multiple_values.dbc", "multiplex_2.dbc", "multiplex_choices.dbc"})
+    {
+        std::ifstream is(std::string(TEST_FILES_PATH) + "/dbc/" + file);
+        auto mux_net = INetwork::LoadDBCFromIs(is);
+        REQUIRE(mux_net);
+        std::vector<std::string> names;
+        for (const IMessage& msg : mux_net->Messages())
+        {
+            for (const ISignal& sig : msg.Signals())
+            {
+                if (rng() % 2 == 0)
+                {
+                    names.push_back(sig.Name());
+                }
+            }
+        }
+        auto by_name = IProjection::Create(*mux_net, names);
+        for (const IMessage& msg : mux_net->Messages())
+        {
+            for (std::size_t i = 0; i < 200; i++)
+            {
+                std::vector<uint8_t> data(std::max<uint64_t>(msg.MessageSize(), 8));
+                for (auto& b : data)
+                {
+                    b = uint8_t(dist(rng));
+                }
+                check(*mux_net, *by_name, msg, &data[0]);
+            }
+        }
+    }
+}
+TEST_CASE("Predicate")
+{
+    using namespace dbcppp;
+
+    uint32_t seed = static_cast<uint32_t>(time(0));
+    std::default_random_engine rng(seed);
+    std::uniform_real_distribution<double> real(-10.0, 10.0);
+
+    // the raw ranges computed from the thresholds agree with comparing the physical values
+    const char* ops[] = {"==", "!=", "<", "<=", ">", ">="};
+    for (std::size_t i = 0; i < 200; i++)
+    {
+        auto random = generate_random_signal(8, rng);
+        double factor = i % 10 == 0 ? 0.0 : real(rng);
+        if (i % 3 == 0)
+        {
+            // a factor like 0.1 makes thresholds hit the physical values exactly
+            factor = std::round(factor) / 10.0;
+        }
+        double offset = i % 2 == 0 ? 0.0 : real(rng);
+        std::vector<std::unique_ptr<ISignal>> signals;
+        signals.push_back(ISignal::Create(8, "Sig", ISignal::EMultiplexer::NoMux, 0, random->StartBit(), random->BitSize(),
+            random->ByteOrder(), random->ValueType(), factor, offset, 0.0, 0.0, "", {}, {}, {}, "", random->ExtendedValueType(), {}));
+        auto msg = IMessage::Create(1, "Msg", 8, "", {}, std::move(signals), {}, "", {});
+        const ISignal& sig = msg->Signals_Get(0);
+        for (std::size_t j = 0; j < 20; j++)
+        {
+            auto data = generate_random_data(8, rng);
+            IMessage::DecodeResult result;
+            msg->Decode(&data[0], result);
+            double phys = sig.RawToPhys(sig.Decode(&data[0]));
+            // thresholds around the value, also the value itself
+            auto other = generate_random_data(8, rng);
+            std::vector<double> thresholds = {phys, sig.RawToPhys(sig.Decode(&other[0])), phys + factor, phys - factor, real(rng) * 1e6};
+            for (double t : thresholds)
+            {
+                if (std::isnan(t) || std::isinf(t))
+                {
+                    continue;
+                }
+                for (std::size_t o = 0; o < 6; o++)
+                {
+                    std::ostringstream expression;
+                    expression << std::setprecision(17) << "Sig " << ops[o] << " " << t;
+                    auto predicate = IPredicate::Create(*msg, expression.str());
+                    REQUIRE(predicate);
+                    bool expected = false;
+                    switch (o)
+                    {
+                    case 0: expected = phys == t; break;
+                    case 1: expected = phys != t; break;
+                    case 2: expected = phys < t; break;
+                    case 3: expected = phys <= t; break;
+                    case 4: expected = phys > t; break;
+                    case 5: expected = phys >= t; break;
+                    }
+                    INFO(expression.str() << " raw " << int64_t(sig.Decode(&data[0])) << " phys " << phys);
+                    REQUIRE(predicate->Evaluate(result) == expected);
+                }
+            }
+        }
+    }
+
+    constexpr const char* test_dbc =
+        "VERSION \"\"\n"
+        "NS_ :\n"
+        "BS_:\n"
+        "BU_:\n"
+        "BO_ 1 Msg: 8 Vector__XXX\n"
+        " SG_ Mux M : 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ Speed m1 : 8|16@1+ (0.01,0) [0|0] \"km/h\" Vector__XXX\n"
+        " SG_ Temperature : 24|8@1- (0.5,-40) [0|0] \"degC\" Vector__XXX\n"
+        " SG_ Gear : 32|4@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        "VAL_ 1 Gear 0 \"P\" 1 \"R\" 2 \"N\" 3 \"D\" ;\n";
+    std::istringstream iss(test_dbc);
+    auto net = INetwork::LoadDBCFromIs(iss);
+    REQUIRE(net);
+    const IMessage& msg = net->Messages_Get(0);
+    auto evaluate =
+        [&](const std::string& expression, uint8_t mux, uint16_t speed, int8_t temperature, uint8_t gear)
+        {
+            uint8_t data[8] = {mux, uint8_t(speed), uint8_t(speed >> 8), uint8_t(temperature), gear};
+            IMessage::DecodeResult result;
+            msg.Decode(data, result);
+            std::string error;
+            auto predicate = IPredicate::Create(msg, expression, &error);
+            REQUIRE(predicate);
+            return predicate->Evaluate(result);
+        };
+    REQUIRE(evaluate("Speed > 80 && Gear == 'D'", 1, 8001, 0, 3));
+    REQUIRE(!evaluate("Speed > 80 && Gear == 'D'", 1, 8000, 0, 3));
+    REQUIRE(!evaluate("Speed > 80 && Gear == \"D\"", 1, 9000, 0, 2));
+    // Speed isn't present for Mux 2, so even != is false
+    REQUIRE(!evaluate("Speed != 80", 2, 0, 0, 0));
+    REQUIRE(evaluate("!(Speed != 80)", 2, 0, 0, 0));
+    REQUIRE(evaluate("Temperature < -39 || Gear != 'P'", 0, 0, 1, 0));
+    REQUIRE(evaluate("Temperature <= -40.5", 0, 0, -1, 0));
+    REQUIRE(!evaluate("Temperature <= -40.5", 0, 0, 0, 0));
+    // unknown signals and labels are false
+    REQUIRE(!evaluate("Unknown == 1", 0, 0, 0, 0));
+    REQUIRE(!evaluate("Gear == 'X'", 0, 0, 0, 0));
+    REQUIRE(evaluate("Gear == 'X' || Gear == 'P'", 0, 0, 0, 0));
+
+    std::string error;
+    for (const char* bad : {"", "Speed", "Speed >", "Speed < 'D'", "(Speed > 1", "Speed > 1 &&", "Speed > 1 Gear",
+        "Speed < nan", "Speed <= NAN", "Speed >= -nan", "Speed > inf", "Speed == -infinity"})
+    {
+        REQUIRE(!IPredicate::Create(msg, bad, &error));
+        REQUIRE(!error.empty());
+    }
+}
+TEST_CASE("EncodeMessage")
+{
+    using namespace dbcppp;
+
+    constexpr const char* test_dbc =
+        "VERSION \"\"\n"
+        "NS_ :\n"
+        "BS_:\n"
+        "BU_:\n"
+        "BO_ 1 Msg: 8 Vector__XXX\n"
+        " SG_ Mux M : 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ A m1 : 8|16@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ B m2 : 8|16@1- (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ C : 24|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        "BA_DEF_ SG_ \"GenSigStartValue\" INT 0 10000;\n"
+        "BA_ \"GenSigStartValue\" SG_ 1 Mux 1;\n"
+        "BA_ \"GenSigStartValue\" SG_ 1 A 100;\n"
+        "BA_ \"GenSigStartValue\" SG_ 1 B 200;\n"
+        "BA_ \"GenSigStartValue\" SG_ 1 C 7;\n";
+    std::istringstream iss(test_dbc);
+    auto net = INetwork::LoadDBCFromIs(iss);
+    REQUIRE(net);
+    const IMessage& msg = net->Messages_Get(0);
+    auto index =
+        [&](const std::string& name)
+        {
+            for (uint32_t i = 0; i < msg.Signals_Size(); i++)
+            {
+                if (msg.Signals_Get(i).Name() == name)
+                {
+                    return i;
+                }
+            }
+            return uint32_t(-1);
+        };
+    auto decode =
+        [&](const uint8_t* frame)
+        {
+            std::map<std::string, int64_t> result;
+            IMessage::DecodeResult decoded;
+            msg.Decode(frame, decoded);
+            for (const auto& entry : decoded)
+            {
+                result[msg.Signals_Get(entry.signal).Name()] = int64_t(entry.raw);
+            }
+            return result;
+        };
+    uint8_t frame[8];
+    using map_t = std::map<std::string, int64_t>;
+
+    // start values of the default switch value
+    REQUIRE(msg.Encode(nullptr, 0, frame, 8) == IMessage::EEncodeError::NoError);
+    REQUIRE(decode(frame) == map_t{{"Mux", 1}, {"A", 100}, {"C", 7}});
+    // start values of another branch
+    IMessage::DecodeResult::Entry mux2[] = {{index("Mux"), 2}};
+    REQUIRE(msg.Encode(mux2, 1, frame, 8) == IMessage::EEncodeError::NoError);
+    REQUIRE(decode(frame) == map_t{{"Mux", 2}, {"B", 200}, {"C", 7}});
+    IMessage::DecodeResult::Entry values[] = {{index("B"), ISignal::raw_t(-3)}, {index("Mux"), 2}, {index("C"), 9}};
+    REQUIRE(msg.Encode(values, 3, frame, 8) == IMessage::EEncodeError::NoError);
+    REQUIRE(decode(frame) == map_t{{"Mux", 2}, {"B", -3}, {"C", 9}});
+
+    IMessage::DecodeResult::Entry inactive[] = {{index("B"), 1}};
+    REQUIRE(msg.Encode(inactive, 1, frame, 8) == IMessage::EEncodeError::SignalNotPresent);
+    IMessage::DecodeResult::Entry invalid[] = {{99, 1}};
+    REQUIRE(msg.Encode(invalid, 1, frame, 8) == IMessage::EEncodeError::InvalidSignal);
+    REQUIRE(msg.Encode(nullptr, 0, frame, 7) == IMessage::EEncodeError::BufferTooSmall);
+
+    // decoding and encoding again yields the same signals, also for extended multiplexing
+    uint32_t seed = static_cast<uint32_t>(time(0));
+    std::default_random_engine rng(seed);
+    std::uniform_int_distribution<uint32_t> dist(0, 3);
+    std::ifstream is(std::string(TEST_FILES_PATH) + "/dbc/issue_184_extended_mux_cascaded.dbc");
+    auto ext_net = INetwork::LoadDBCFromIs(is);
+    REQUIRE(ext_net);
+    for (const INetwork* n : {net.get(), ext_net.get()})
+    {
+        const IMessage& m = n->Messages_Get(0);
+        for (std::size_t i = 0; i < 1000; i++)
+        {
+            uint8_t data[8];
+            for (auto& b : data)
+            {
+                b = uint8_t(dist(rng));
+            }
+            IMessage::DecodeResult decoded;
+            m.Decode(data, decoded);
+            uint8_t encoded[8];
+            REQUIRE(m.Encode(decoded.begin(), decoded.Size(), encoded, 8) == IMessage::EEncodeError::NoError);
+            IMessage::DecodeResult redecoded;
+            m.Decode(encoded, redecoded);
+            REQUIRE(redecoded.Size() == decoded.Size());
+            for (std::size_t j = 0; j < decoded.Size(); j++)
+            {
+                REQUIRE(redecoded[j].signal == decoded[j].signal);
+                REQUIRE(redecoded[j].raw == decoded[j].raw);
+            }
+        }
+        // a signal of another branch
+        for (uint32_t i = 0; i < m.Signals_Size(); i++)
+        {
+            uint8_t data[8] = {};
+            IMessage::DecodeResult decoded;
+            m.Decode(data, decoded);
+            bool present = std::any_of(decoded.begin(), decoded.end(), [&](const auto& e) { return e.signal == i; });
+            IMessage::DecodeResult::Entry entry[] = {{i, 0}};
+            // the switches of the zero frame are 0, so only signals present for them can be set
+            uint8_t encoded[8];
+            auto error = m.Encode(entry, 1, encoded, 8);
+            const ISignal& sig = m.Signals_Get(i);
+            if (sig.MultiplexerIndicator() != ISignal::EMultiplexer::MuxValue)
+            {
+                REQUIRE(error == IMessage::EEncodeError::NoError);
+            }
+            else if (n == ext_net.get())
+            {
+                REQUIRE(error == (present ? IMessage::EEncodeError::NoError : IMessage::EEncodeError::SignalNotPresent));
+            }
+            else
+            {
+                // without a switch value the frame is built for the switch's start value
+                uint8_t start[8];
+                REQUIRE(m.Encode(nullptr, 0, start, 8) == IMessage::EEncodeError::NoError);
+                bool selected = m.MuxSignal()->Decode(start) == sig.MultiplexerSwitchValue();
+                REQUIRE(error == (selected ? IMessage::EEncodeError::NoError : IMessage::EEncodeError::SignalNotPresent));
+            }
+        }
+        if (n == net.get())
+        {
+            // a plain m<n> signal is rejected for any other switch value given with it
+            for (uint64_t switch_value : {0, 1, 2, 3})
+            {
+                for (const char* name : {"A", "B"})
+                {
+                    const ISignal& sig = m.Signals_Get(index(name));
+                    IMessage::DecodeResult::Entry entries[] = {{index("Mux"), switch_value}, {index(name), 5}};
+                    uint8_t encoded[8];
+                    auto error = m.Encode(entries, 2, encoded, 8);
+                    REQUIRE(error == (sig.MultiplexerSwitchValue() == switch_value
+                        ? IMessage::EEncodeError::NoError : IMessage::EEncodeError::SignalNotPresent));
+                }
+            }
+        }
+    }
+}
@@ -1,4 +1,5 @@
 #include <regex>
+#include <algorithm>
 #include <array>
 #include <string>
 #include <vector>
@@ -12,6 +13,8 @@
 
 #include "dbcppp/Network.h"
 #include "dbcppp/Network2Functions.h"
+#include "dbcppp/Predicate.h"
+#include "dbcppp/BusRouter.h"
 
 void print_help()
 {
@@ -88,7 +91,8 @@ int main(int argc, char** argv)
     {
         options.add_options()
             ("h,help", "Produce help message")
-            ("bus", "List of buses in format <<bus name>:<DBC filename>>", cxxopts::value<std::vector<std::string>>());
+            ("bus", "List of buses in format <<bus name>:<DBC filename>>", cxxopts::value<std::vector<std::string>>())
+            ("where", "Only print frames fulfilling the condition, e.g. \"Speed > 80 && Gear == 'D'\"", cxxopts::value<std::string>());
         for (std::size_t i = 1; i < argc - 1; i++)
         {
             argv[i] = argv[i + 1];
@@ -96,7 +100,7 @@ int main(int argc, char** argv)
         auto vm = options.parse(argc, argv);
         if (vm.count("help"))
         {
-            std::cout << "Usage:\ndbcppp decode [--help] --bus=<<bus name>:<DBC filename>>...\n";
+            std::cout << "Usage:\ndbcppp decode [--help] [--where=<condition>] --bus=<<bus name>:<DBC filename>>...\n";
             std::cout << options.help();
             return 1;
         }
@@ -106,20 +110,18 @@ int main(int argc, char** argv)
             return 1;
         }
         const auto& opt_buses = vm["bus"].as<std::vector<std::string>>();
-        struct Bus
-        {
-            std::string name;
-            std::unique_ptr<dbcppp::INetwork> net;
-        };
-        std::unordered_map<std::string, Bus> buses;
+        // the bus names are mapped to the indices of the router once, when the arguments are parsed
+        std::vector<std::unique_ptr<dbcppp::INetwork>> nets;
+        std::unordered_map<std::string, std::size_t> bus_indices;
+        auto router = dbcppp::IBusRouter::Create();
         for (const auto& opt_bus : opt_buses)
         {
             std::istringstream ss(opt_bus);
             std::string opt;
-            Bus b;
+            std::string name;
             if (std::getline(ss, opt, ':'))
             {
-                b.name = opt;
+                name = opt;
             }
             else
             {
@@ -129,20 +131,25 @@ int main(int argc, char** argv)
             if (std::getline(ss, opt))
             {
                 std::ifstream fdbc(opt);
-                b.net = dbcppp::INetwork::LoadDBCFromIs(fdbc);
-                if (!b.net)
+                auto net = dbcppp::INetwork::LoadDBCFromIs(fdbc);
+                if (!net)
                 {
                     std::cout << "error: could not load DBC '" << opt << "'" << std::endl;
                     return 1;
                 }
+                auto bus = bus_indices.insert(std::make_pair(name, bus_indices.size())).first->second;
+                router->SetBus(bus, net.get());
+                nets.push_back(std::move(net));
             }
             else
             {
                 std::cout << "error: could parse bus parameter" << std::endl;
                 return 1;
             }
-            buses.insert(std::make_pair(b.name, std::move(b)));
         }
+        std::string where = vm.count("where") ? vm["where"].as<std::string>() : "";
+        // compiled for each message when its first frame arrives
+        std::unordered_map<const dbcppp::IMessage*, std::unique_ptr<dbcppp::IPredicate>> predicates;
         // example line: vcan0  123   [3]  11 22 33
         std::regex regex_candump_line(
             // vcan0
@@ -163,42 +170,72 @@ int main(int argc, char** argv)
             "\\s*([0-9A-F]{2})?"
             "\\s*([0-9A-F]{2})?"
             "\\s*([0-9A-F]{2})?");
+        constexpr std::size_t unknown_bus = std::size_t(-1);
+        std::string last_bus_name;
+        std::size_t last_bus = unknown_bus;
         std::string line;
         while (std::getline(std::cin, line))
         {
             std::cmatch cm;
-            std::regex_match(line.c_str(), cm, regex_candump_line);
-            const auto& bus = buses.find(cm[1].str());
-            if (bus != buses.end())
+            if (!std::regex_match(line.c_str(), cm, regex_candump_line))
+            {
+                continue;
+            }
+            // consecutive frames are usually on the same bus, so the name is only looked up when it changes
+            if (cm[1].length() != last_bus_name.size() ||
+                !std::equal(cm[1].first, cm[1].second, last_bus_name.begin()))
+            {
+                last_bus_name = cm[1].str();
+                auto bus = bus_indices.find(last_bus_name);
+                last_bus = bus != bus_indices.end() ? bus->second : unknown_bus;
+            }
+            if (last_bus != unknown_bus)
             {
                 uint64_t msg_id = std::strtol(cm[2].str().c_str(), nullptr, 16);
-                uint64_t msg_size = std::atoi(cm[3].str().c_str());
-                std::array<uint8_t, 8> data;
-                for (std::size_t i = 0; i < msg_size; i++)
+                // only as many bytes as the line holds, Decode reads the missing ones as zero
+                std::size_t dlc = std::atoi(cm[3].str().c_str());
+                std::size_t msg_size = 0;
+                std::array<uint8_t, 64> data;
+                while (msg_size < dlc && 4 + msg_size < cm.size() && cm[4 + msg_size].matched)
                 {
-                    data[i] = uint8_t(std::strtol(cm[4 + i].str().c_str(), nullptr, 16));
+                    data[msg_size] = uint8_t(std::strtol(cm[4 + msg_size].str().c_str(), nullptr, 16));
+                    msg_size++;
                 }
-                auto beg_msg = bus->second.net->Messages().begin();
-                auto end_msg = bus->second.net->Messages().end();
-                auto iter = std::find_if(beg_msg, end_msg, [&](const dbcppp::IMessage& msg) { return msg.Id() == msg_id; });
-                if (iter != end_msg)
+                const dbcppp::IMessage* msg = router->Route(last_bus, msg_id);
+                if (msg)
                 {
-                    const dbcppp::IMessage* msg = &*iter;
+                    // only the signals selected by the (extended) multiplexing
+                    dbcppp::IMessage::DecodeResult result;
+                    msg->Decode(&data[0], msg_size, result);
+                    if (!where.empty())
+                    {
+                        auto& predicate = predicates[msg];
+                        if (!predicate)
+                        {
+                            std::string error;
+                            predicate = dbcppp::IPredicate::Create(*msg, where, &error);
+                            if (!predicate)
+                            {
+                                std::cout << "Argument error: --where: " << error << std::endl;
+                                return 1;
+                            }
+                        }
+                        // the condition is checked on the raw values, rejected frames are never converted
+                        if (!predicate->Evaluate(result))
+                        {
+                            continue;
+                        }
+                    }
                     std::cout << line << " :: " << msg->Name() << "(";
                     bool first = true;
-                    const auto* mux_sig = msg->MuxSignal();
-
                     auto print_signal =
-                        [&data](const dbcppp::ISignal& sig, bool first)
+                        [](const dbcppp::ISignal& sig, dbcppp::ISignal::raw_t raw, bool first)
                         {
                             if (!first) std::cout << ", ";
-                            auto raw = sig.Decode(&data[0]);
-                            auto beg_ved = sig.ValueEncodingDescriptions().begin();
-                            auto end_ved = sig.ValueEncodingDescriptions().end();
-                            auto iter = std::find_if(beg_ved, end_ved, [&](const dbcppp::IValueEncodingDescription& ved) { return ved.Value() == raw; });
-                            if (iter != end_ved)
+                            auto description = sig.ValueToDescription(int64_t(raw));
+                            if (description)
                             {
-                                std::cout << sig.Name() << ": '" << iter->Description() << "' " << sig.Unit();
+                                std::cout << sig.Name() << ": '" << *description << "' " << sig.Unit();
                             }
                             else
                             {
@@ -211,67 +248,19 @@ int main(int argc, char** argv)
                             }
                         };
 
-                    for (const dbcppp::ISignal& sig : msg->Signals())
+                    for (const auto& entry : result)
                     {
-                        if (sig.MultiplexerIndicator() != dbcppp::ISignal::EMultiplexer::MuxValue)
-                        {
-                            print_signal(sig, first);
-                            first = false;
-                        }
-                        else if (mux_sig && sig.SignalMultiplexerValues_Size() == 0 &&
-                            sig.MultiplexerSwitchValue() == mux_sig->Decode(&data[0]))
-                        {
-                            print_signal(sig, first);
-                            first = false;
-                        }
-                        else
-                        {
-                            std::function<bool(const dbcppp::ISignal&)> check_signal_multiplexer_values;
-                            check_signal_multiplexer_values =
-                                [&](const dbcppp::ISignal& sig)
-                                    -> bool
-                                {
-                                    for (const auto& smv : sig.SignalMultiplexerValues())
-                                    {
-                                        auto sig_beg = msg->Signals().begin();
-                                        auto sig_end = msg->Signals().end();
-                                        auto sig_iter = std::find_if(sig_beg, sig_end,
-                                            [&](const auto& sig)
-                                            {
-                                                return sig.Name() == smv.SwitchName();
-                                            });
-                                        if (sig_iter != sig_end)
-                                        {
-                                            for (auto ranges : smv.ValueRanges())
-                                            {
-                                                auto raw = sig_iter->Decode(&data[0]);
-                                                if (ranges.from >= raw && ranges.to <= raw)
-                                                {
-                                                    if (sig_iter->SignalMultiplexerValues_Size() != 0)
-                                                    {
-                                                        return check_signal_multiplexer_values(*sig_iter);
-                                                    }
-                                                    else
-                                                    {
-                                                        return true;
-                                                    }
-                                                }
-                                            }
-                                        }
-                                    }
-                                    return false;
-                                };
-                            if (check_signal_multiplexer_values(sig))
-                            {
-                                print_signal(sig, first);
-                                first = false;
-                            }
-                        }
+                        print_signal(msg->Signals_Get(entry.signal), entry.raw, first);
+                        first = false;
                     }
                     std::cout << ")\n";
                 }
             }
         }
+        if (router->Unrouted())
+        {
+            std::cerr << router->Unrouted() << " frame(s) of the given buses had no message in the DBC\n";
+        }
     }
     else
     {